@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string_view>
+#include <vector>
+
+#include "messages/IdentityMessage.h"
+#include "messages/MessageHeader.h"
+
+// The IdentityMessage every benchmark sends or decodes: a version 5 request
+// with all fields filled the way a client fills them. Senders patch the
+// kind, id, correlation id and send time in place for every message.
+namespace request_fixture {
+
+constexpr std::size_t REQUEST_LENGTH =
+    messages::MessageHeader::encodedLength() +
+    messages::IdentityMessage::sbeBlockLength();
+
+constexpr std::string_view VERIFY_MSG = "Identity Verification Request";
+constexpr std::string_view ADD_MSG = "Add User in System";
+constexpr std::string_view TYPE = "passport";
+constexpr std::string_view ID = "AB1234567";
+constexpr std::string_view NAME = "Jane Doe";
+constexpr std::string_view DATE_OF_ISSUE = "2020-01-15";
+constexpr std::string_view DATE_OF_EXPIRY = "2030-01-14";
+constexpr std::string_view ADDRESS = "12 Example Street";
+constexpr std::string_view VERIFIED = "false";
+
+// Switch a filled request between an add and a verification
+inline void set_add(messages::IdentityMessage &identity, bool add) {
+    identity.msg().putCharVal(add ? ADD_MSG : VERIFY_MSG);
+    identity.kind(add ? messages::MessageKind::ADD_USER_REQUEST
+                      : messages::MessageKind::VERIFICATION_REQUEST);
+}
+
+// Identity number prefix followed by number as ten digits, e.g. LG0000000042
+inline void set_id(messages::IdentityMessage &identity, const char *prefix,
+                   std::uint64_t number) {
+    char id[32];
+    const int length = std::snprintf(id, sizeof(id), "%s%010llu", prefix,
+                                     static_cast<unsigned long long>(number));
+    identity.id().putCharVal(std::string_view(id, static_cast<std::size_t>(
+                                                      length)));
+}
+
+// Wrap buffer, at least REQUEST_LENGTH bytes, and write a verification
+// request for ID with correlation id 1 into it
+inline void fill(messages::IdentityMessage &identity, char *buffer,
+                 std::size_t length) {
+    identity.wrapAndApplyHeader(buffer, 0, length);
+    set_add(identity, false);
+    identity.type().putCharVal(TYPE);
+    identity.id().putCharVal(ID);
+    identity.name().putCharVal(NAME);
+    identity.dateOfIssue().putCharVal(DATE_OF_ISSUE);
+    identity.dateOfExpiry().putCharVal(DATE_OF_EXPIRY);
+    identity.address().putCharVal(ADDRESS);
+    identity.verified().putCharVal(VERIFIED);
+    identity.isVerified(messages::BooleanType::F);
+    identity.correlationId(1);
+    identity.clientSendTimeNs(0);
+    identity.engineReceiveTimeNs(0);
+    identity.engineSendTimeNs(0);
+}
+
+// The request in a buffer of its own
+inline std::vector<char> make_request() {
+    std::vector<char> buffer(REQUEST_LENGTH);
+    messages::IdentityMessage identity;
+    fill(identity, buffer.data(), buffer.size());
+    return buffer;
+}
+
+}  // namespace request_fixture
@@ -0,0 +1,424 @@
+// Open-loop load generator: publishes IdentityMessage requests to a running
+// engine at a fixed rate, reads the responses and reports throughput and
+// round-trip latency percentiles.
+//
+// Requests are due at fixed intervals from the start of the run whether or
+// not earlier ones were answered, and latency is measured from when a request
+// was due rather than when it was sent. A stall in the engine or the sender
+// is then charged to every request scheduled behind it, correcting for
+// coordinated omission. The uncorrected latency, from the send time echoed in
+// clientSendTimeNs, is printed alongside for comparison.
+//
+// Channels and stream ids come from config.txt, mirrored: requests go to the
+// engine's subscription and responses are read from its publication, from
+// every shard's stream with PUBLICATION_PER_SHARD. Run from the build
+// directory, like the engine.
+//
+// Usage: ekyc_loadgen [--rate=N] [--duration=S] [--warmup=S]
+//                     [--add-ratio=R] [--identities=N] [--embedded-driver]
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "Config.h"
+#include "LatencyHistogram.h"
+#include "RequestFixture.h"
+#include "aeron_wrapper.h"
+#include "helper.h"
+#include "messages/IdentityMessage.h"
+#include "messages/MessageHeader.h"
+
+#ifdef EKYC_EMBEDDED_MEDIA_DRIVER
+#include "aeronmd.h"
+#endif
+
+namespace {
+
+struct Options {
+    // Requests per second
+    std::uint64_t rate = 10000;
+    // Measured seconds, after the warm-up
+    std::uint64_t durationS = 30;
+    // Seconds of load whose responses are not recorded
+    std::uint64_t warmupS = 5;
+    // Fraction of requests that add a user, the rest verify one
+    double addRatio = 0.1;
+    // Identity numbers are drawn uniformly from this many
+    std::uint64_t identities = 100000;
+    bool embeddedDriver = false;
+};
+
+// How long to wait for the engine's subscription, then for stragglers
+constexpr auto CONNECT_TIMEOUT = std::chrono::seconds(10);
+constexpr auto DRAIN_TIMEOUT = std::chrono::seconds(5);
+constexpr int FRAGMENT_LIMIT = 64;
+
+using request_fixture::REQUEST_LENGTH;
+
+void usage(const char *program) {
+    std::fprintf(stderr,
+                 "Usage: %s [--rate=N] [--duration=S] [--warmup=S] "
+                 "[--add-ratio=R] [--identities=N] [--embedded-driver]\n",
+                 program);
+    std::exit(2);
+}
+
+Options parse_options(int argc, char **argv) {
+    Options options;
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg = argv[i];
+        const auto equals = arg.find('=');
+        const std::string_view key = arg.substr(0, equals);
+        const std::string value(
+            equals == std::string_view::npos ? "" : arg.substr(equals + 1));
+
+        if (key == "--embedded-driver")
+            options.embeddedDriver = true;
+        else if (value.empty())
+            usage(argv[0]);
+        else if (key == "--rate")
+            options.rate = std::strtoull(value.c_str(), nullptr, 10);
+        else if (key == "--duration")
+            options.durationS = std::strtoull(value.c_str(), nullptr, 10);
+        else if (key == "--warmup")
+            options.warmupS = std::strtoull(value.c_str(), nullptr, 10);
+        else if (key == "--add-ratio")
+            options.addRatio = std::strtod(value.c_str(), nullptr);
+        else if (key == "--identities")
+            options.identities = std::strtoull(value.c_str(), nullptr, 10);
+        else
+            usage(argv[0]);
+    }
+    if (options.rate == 0 || options.durationS == 0 ||
+        options.identities == 0 || options.addRatio < 0.0 ||
+        options.addRatio > 1.0)
+        usage(argv[0]);
+    return options;
+}
+
+std::uint64_t steady_nanos() noexcept {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+#ifdef EKYC_EMBEDDED_MEDIA_DRIVER
+// A media driver running on its own threads inside this process
+class EmbeddedDriver final {
+   public:
+    explicit EmbeddedDriver(const std::string &dir) {
+        if (aeron_driver_context_init(&_context) < 0)
+            throw std::runtime_error(aeron_errmsg());
+        if (!dir.empty()) aeron_driver_context_set_dir(_context, dir.c_str());
+        aeron_driver_context_set_dir_delete_on_start(_context, true);
+        if (aeron_driver_init(&_driver, _context) < 0 ||
+            aeron_driver_start(_driver, false) < 0) {
+            const std::string error = aeron_errmsg();
+            close();
+            throw std::runtime_error(error);
+        }
+    }
+
+    ~EmbeddedDriver() { close(); }
+
+    EmbeddedDriver(const EmbeddedDriver &) = delete;
+    EmbeddedDriver &operator=(const EmbeddedDriver &) = delete;
+
+   private:
+    void close() {
+        if (_driver) aeron_driver_close(_driver);
+        if (_context) aeron_driver_context_close(_context);
+        _driver = nullptr;
+        _context = nullptr;
+    }
+
+    aeron_driver_context_t *_context = nullptr;
+    aeron_driver_t *_driver = nullptr;
+};
+#endif
+
+// Reads responses on its own thread, recording each one's latency
+class ResponseReader final {
+   public:
+    ResponseReader(std::vector<aeron_wrapper::Subscription *> subscriptions,
+                   std::uint64_t startNs, std::uint64_t rate,
+                   std::uint64_t warmupRequests)
+        : _subscriptions(std::move(subscriptions)),
+          _startNs(startNs),
+          _rate(rate),
+          _warmupRequests(warmupRequests) {}
+
+    void start() {
+        _running = true;
+        _thread = std::thread([this]() { run(); });
+    }
+
+    void stop() {
+        _running = false;
+        if (_thread.joinable()) _thread.join();
+    }
+
+    std::uint64_t received() const {
+        return _received.load(std::memory_order_relaxed);
+    }
+    std::uint64_t verified() const {
+        return _verified.load(std::memory_order_relaxed);
+    }
+    const LatencyHistogram &corrected() const { return _corrected; }
+    const LatencyHistogram &uncorrected() const { return _uncorrected; }
+
+   private:
+    void run() {
+        const aeron_wrapper::FragmentHandler handler =
+            [this](const aeron_wrapper::FragmentData &fragmentData) {
+                on_fragment(fragmentData);
+            };
+        while (_running.load(std::memory_order_relaxed)) {
+            int fragments = 0;
+            for (auto *subscription : _subscriptions)
+                fragments += subscription->poll(handler, FRAGMENT_LIMIT);
+            if (fragments == 0) std::this_thread::yield();
+        }
+    }
+
+    void on_fragment(const aeron_wrapper::FragmentData &fragmentData) {
+        const std::uint64_t nowNs = steady_nanos();
+        const std::uint64_t nowEpochNs = epoch_nanos();
+
+        char *buffer = reinterpret_cast<char *>(
+                           fragmentData.atomicBuffer.buffer()) +
+                       fragmentData.offset;
+        const std::uint64_t length = fragmentData.length;
+        if (length < REQUEST_LENGTH) return;
+
+        messages::MessageHeader msgHeader(buffer, length);
+        if (msgHeader.templateId() !=
+            messages::IdentityMessage::sbeTemplateId())
+            return;
+        messages::IdentityMessage identity;
+        identity.wrapForDecode(buffer, msgHeader.encodedLength(),
+                               msgHeader.blockLength(), msgHeader.version(),
+                               length);
+        // Over IPC the engine's streams may be ours too, skip the requests
+        if (identity.kind() != messages::MessageKind::VERIFICATION_RESPONSE)
+            return;
+
+        // Correlation ids count requests from 1
+        const std::uint64_t correlationId = identity.correlationId();
+        using messages::IdentityMessage;
+        if (correlationId == 0 ||
+            correlationId == IdentityMessage::correlationIdNullValue())
+            return;
+
+        _received.fetch_add(1, std::memory_order_relaxed);
+        if (identity.isVerified() == messages::BooleanType::T)
+            _verified.fetch_add(1, std::memory_order_relaxed);
+        if (correlationId <= _warmupRequests) return;
+
+        const std::uint64_t dueNs =
+            _startNs + (correlationId - 1) * 1000000000ULL / _rate;
+        _corrected.record(nowNs > dueNs ? nowNs - dueNs : 0);
+        const std::uint64_t sentNs = identity.clientSendTimeNs();
+        _uncorrected.record(nowEpochNs > sentNs ? nowEpochNs - sentNs : 0);
+    }
+
+    const std::vector<aeron_wrapper::Subscription *> _subscriptions;
+    const std::uint64_t _startNs;
+    const std::uint64_t _rate;
+    const std::uint64_t _warmupRequests;
+
+    std::thread _thread;
+    std::atomic<bool> _running{false};
+    std::atomic<std::uint64_t> _received{0};
+    std::atomic<std::uint64_t> _verified{0};
+    LatencyHistogram _corrected;
+    LatencyHistogram _uncorrected;
+};
+
+// A request template patched in place for every send
+class RequestWriter final {
+   public:
+    explicit RequestWriter(const Options &options)
+        : _addRatio(options.addRatio),
+          _identities(0, options.identities - 1) {
+        request_fixture::fill(_identity, _buffer, sizeof(_buffer));
+    }
+
+    // Next request, addressed by correlationId and stamped with sendTimeNs
+    const std::uint8_t *next(std::uint64_t correlationId,
+                             std::uint64_t sendTimeNs) {
+        request_fixture::set_add(_identity, _mix(_random) < _addRatio);
+        request_fixture::set_id(_identity, "LG", _identities(_random));
+        _identity.correlationId(correlationId);
+        _identity.clientSendTimeNs(sendTimeNs);
+        return reinterpret_cast<const std::uint8_t *>(_buffer);
+    }
+
+   private:
+    const double _addRatio;
+    // Fixed seed, so runs send the same sequence
+    std::mt19937_64 _random{42};
+    std::uniform_real_distribution<double> _mix{0.0, 1.0};
+    std::uniform_int_distribution<std::uint64_t> _identities;
+
+    char _buffer[REQUEST_LENGTH];
+    messages::IdentityMessage _identity;
+};
+
+std::string channel(const std::string &ip, int port) {
+    const auto &cfg = Config::get();
+    return "aeron:" + cfg.AERON_PROTOCOL + "?endpoint=" + ip + ":" +
+           std::to_string(port);
+}
+
+void print_latencies(const char *label, const LatencyHistogram &histogram) {
+    LatencyHistogram::Counts counts{};
+    histogram.add_to(counts);
+    const auto us = [](std::uint64_t ns) { return ns / 1000.0; };
+    std::printf("%-12s p50 %9.1f  p90 %9.1f  p99 %9.1f  p99.9 %9.1f  "
+                "p99.99 %9.1f  max %9.1f us\n",
+                label, us(LatencyHistogram::percentile(counts, 50.0)),
+                us(LatencyHistogram::percentile(counts, 90.0)),
+                us(LatencyHistogram::percentile(counts, 99.0)),
+                us(LatencyHistogram::percentile(counts, 99.9)),
+                us(LatencyHistogram::percentile(counts, 99.99)),
+                us(LatencyHistogram::max(counts)));
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    const Options options = parse_options(argc, argv);
+
+    try {
+        const auto &cfg = Config::get();
+
+#ifdef EKYC_EMBEDDED_MEDIA_DRIVER
+        std::unique_ptr<EmbeddedDriver> driver;
+        if (options.embeddedDriver) {
+            driver = std::make_unique<EmbeddedDriver>(cfg.AERON_DIR);
+            std::printf("Embedded media driver started\n");
+        }
+#else
+        if (options.embeddedDriver) {
+            std::fprintf(stderr,
+                         "Built without the Aeron C media driver, start "
+                         "aeronmd instead\n");
+            return 2;
+        }
+#endif
+
+        aeron_wrapper::Aeron aeron(cfg.AERON_DIR);
+        auto publication = aeron.create_publication(
+            channel(cfg.SUBSCRIPTION_IP, cfg.SUBSCRIPTION_PORT),
+            cfg.SUBSCRIPTION_STREAM_ID);
+        // One response stream, or one per shard
+        const int streams =
+            cfg.PUBLICATION_PER_SHARD ? std::max(cfg.NUM_SHARDS, 1) : 1;
+        std::vector<std::unique_ptr<aeron_wrapper::Subscription>>
+            subscriptions;
+        std::vector<aeron_wrapper::Subscription *> responseStreams;
+        for (int i = 0; i < streams; ++i) {
+            subscriptions.push_back(aeron.create_subscription(
+                channel(cfg.PUBLICATION_IP, cfg.PUBLICATION_PORT),
+                cfg.PUBLICATION_STREAM_ID + i));
+            responseStreams.push_back(subscriptions.back().get());
+        }
+
+        const auto connectDeadline =
+            std::chrono::steady_clock::now() + CONNECT_TIMEOUT;
+        while (!publication->is_connected()) {
+            if (std::chrono::steady_clock::now() >= connectDeadline) {
+                std::fprintf(stderr, "No engine subscribed to requests\n");
+                return 1;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+
+        const std::uint64_t warmupRequests = options.warmupS * options.rate;
+        const std::uint64_t totalRequests =
+            warmupRequests + options.durationS * options.rate;
+        std::printf("Sending %llu requests at %llu/s (%llu warm-up), "
+                    "%.0f%% adds over %llu identities\n",
+                    static_cast<unsigned long long>(totalRequests),
+                    static_cast<unsigned long long>(options.rate),
+                    static_cast<unsigned long long>(warmupRequests),
+                    options.addRatio * 100.0,
+                    static_cast<unsigned long long>(options.identities));
+
+        RequestWriter writer(options);
+        const std::uint64_t startNs = steady_nanos();
+        ResponseReader reader(std::move(responseStreams), startNs,
+                              options.rate, warmupRequests);
+        reader.start();
+
+        std::uint64_t backPressured = 0;
+        std::uint64_t maxLagNs = 0;
+        for (std::uint64_t i = 0; i < totalRequests; ++i) {
+            // Open loop: wait for the request's slot, never for a response
+            const std::uint64_t dueNs =
+                startNs + i * 1000000000ULL / options.rate;
+            std::uint64_t nowNs = steady_nanos();
+            while (nowNs < dueNs) nowNs = steady_nanos();
+            if (nowNs - dueNs > maxLagNs) maxLagNs = nowNs - dueNs;
+
+            const std::uint8_t *request = writer.next(i + 1, epoch_nanos());
+            using aeron_wrapper::PublicationResult;
+            while (true) {
+                const auto result = publication->offer(request, REQUEST_LENGTH);
+                if (result == PublicationResult::SUCCESS) break;
+                if (result != PublicationResult::BACK_PRESSURED &&
+                    result != PublicationResult::ADMIN_ACTION)
+                    throw std::runtime_error(
+                        "offer failed: " +
+                        aeron_wrapper::pubresult_to_string(result));
+                ++backPressured;
+            }
+        }
+        const std::uint64_t sendEndNs = steady_nanos();
+
+        const auto drainDeadline =
+            std::chrono::steady_clock::now() + DRAIN_TIMEOUT;
+        while (reader.received() < totalRequests &&
+               std::chrono::steady_clock::now() < drainDeadline)
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        const std::uint64_t endNs = steady_nanos();
+        reader.stop();
+
+        const double sendSeconds = (sendEndNs - startNs) / 1e9;
+        const double totalSeconds = (endNs - startNs) / 1e9;
+        const std::uint64_t received = reader.received();
+        std::printf("sent         %llu in %.2f s (%.0f/s), %llu back-pressured "
+                    "offers, sender at most %.1f us behind schedule\n",
+                    static_cast<unsigned long long>(totalRequests),
+                    sendSeconds, totalRequests / sendSeconds,
+                    static_cast<unsigned long long>(backPressured),
+                    maxLagNs / 1000.0);
+        std::printf("received     %llu in %.2f s (%.0f/s), %llu verified, "
+                    "%llu missing\n",
+                    static_cast<unsigned long long>(received), totalSeconds,
+                    received / totalSeconds,
+                    static_cast<unsigned long long>(reader.verified()),
+                    static_cast<unsigned long long>(totalRequests - received));
+        print_latencies("corrected", reader.corrected());
+        print_latencies("uncorrected", reader.uncorrected());
+        return received == totalRequests ? 0 : 1;
+    } catch (const std::exception &e) {
+        std::fprintf(stderr, "Error: %s\n", e.what());
+        return 1;
+    }
+}
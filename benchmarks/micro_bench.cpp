@@ -0,0 +1,317 @@
+// Per-message CPU costs of the request path: SBE header and message
+// wrapping, Char64str field access, request decoding, response encoding and
+// the helper.h conversions.
+//
+// Each benchmark doubles its iteration count until a run takes at least the
+// minimum time, then reports nanoseconds per operation. The JSON output
+// follows Google Benchmark's layout, so its compare.py can diff two runs.
+//
+// Usage: micro_bench [--format=json|console] [--filter=SUBSTRING]
+//                    [--min-time=SECONDS]
+
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "IdentityRequest.h"
+#include "RequestFixture.h"
+#include "ResponseEncoder.h"
+#include "helper.h"
+#include "messages/IdentityMessage.h"
+#include "messages/MessageHeader.h"
+
+namespace {
+
+using request_fixture::make_request;
+
+// Keep the compiler from discarding value or the work that produced it
+template <typename T>
+inline void keep(const T &value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+// Runs the benchmarked operation iterations times
+using Body = std::function<void(std::uint64_t iterations)>;
+
+struct Benchmark {
+    std::string name;
+    Body body;
+};
+
+struct Result {
+    std::string name;
+    std::uint64_t iterations;
+    double realNs;
+    double cpuNs;
+};
+
+double cpu_seconds() {
+    timespec ts;
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+Result run(const Benchmark &benchmark, double minSeconds) {
+    // Warm up caches and branch predictors
+    benchmark.body(1000);
+
+    for (std::uint64_t iterations = 1000;; iterations *= 2) {
+        const double cpuStart = cpu_seconds();
+        const auto start = std::chrono::steady_clock::now();
+        benchmark.body(iterations);
+        const double real = std::chrono::duration<double>(
+                                std::chrono::steady_clock::now() - start)
+                                .count();
+        const double cpu = cpu_seconds() - cpuStart;
+        if (real >= minSeconds || iterations >= (std::uint64_t{1} << 40))
+            return {benchmark.name, iterations, real * 1e9 / iterations,
+                    cpu * 1e9 / iterations};
+    }
+}
+
+using Field = messages::Char64str &(messages::IdentityMessage::*)();
+
+struct NamedField {
+    const char *name;
+    Field field;
+    std::string_view value;
+};
+
+const NamedField FIELDS[] = {
+    {"msg", &messages::IdentityMessage::msg, request_fixture::VERIFY_MSG},
+    {"type", &messages::IdentityMessage::type, request_fixture::TYPE},
+    {"id", &messages::IdentityMessage::id, request_fixture::ID},
+    {"name", &messages::IdentityMessage::name, request_fixture::NAME},
+    {"dateOfIssue", &messages::IdentityMessage::dateOfIssue,
+     request_fixture::DATE_OF_ISSUE},
+    {"dateOfExpiry", &messages::IdentityMessage::dateOfExpiry,
+     request_fixture::DATE_OF_EXPIRY},
+    {"address", &messages::IdentityMessage::address,
+     request_fixture::ADDRESS},
+    {"verified", &messages::IdentityMessage::verified,
+     request_fixture::VERIFIED},
+};
+
+void wrap_for_decode(messages::IdentityMessage &identity,
+                     std::vector<char> &request) {
+    messages::MessageHeader msgHeader(request.data(), request.size());
+    identity.wrapForDecode(request.data(), msgHeader.encodedLength(),
+                           msgHeader.blockLength(), msgHeader.version(),
+                           request.size());
+}
+
+std::vector<Benchmark> codec_benchmarks() {
+    std::vector<Benchmark> benchmarks;
+
+    benchmarks.push_back({"sbe/header_wrap_decode", [](std::uint64_t n) {
+                              std::vector<char> request = make_request();
+                              messages::IdentityMessage identity;
+                              for (std::uint64_t i = 0; i < n; ++i) {
+                                  keep(request.data());
+                                  wrap_for_decode(identity, request);
+                                  keep(identity);
+                              }
+                          }});
+
+    for (const auto &field : FIELDS) {
+        benchmarks.push_back(
+            {std::string("sbe/get_string/") + field.name,
+             [field](std::uint64_t n) {
+                 std::vector<char> request = make_request();
+                 messages::IdentityMessage identity;
+                 wrap_for_decode(identity, request);
+                 for (std::uint64_t i = 0; i < n; ++i) {
+                     std::string value = (identity.*field.field)()
+                                             .getCharValAsString();
+                     keep(value);
+                 }
+             }});
+    }
+    // The non-allocating accessor the request path uses instead
+    benchmarks.push_back({"sbe/get_view/id", [](std::uint64_t n) {
+                              std::vector<char> request = make_request();
+                              messages::IdentityMessage identity;
+                              wrap_for_decode(identity, request);
+                              for (std::uint64_t i = 0; i < n; ++i) {
+                                  std::string_view value =
+                                      identity.id().getCharValAsStringView();
+                                  keep(value);
+                              }
+                          }});
+
+    for (const auto &field : FIELDS) {
+        benchmarks.push_back(
+            {std::string("sbe/put/") + field.name, [field](std::uint64_t n) {
+                 std::vector<char> buffer(response_encoder::RESPONSE_LENGTH);
+                 messages::IdentityMessage identity;
+                 identity.wrapAndApplyHeader(buffer.data(), 0, buffer.size());
+                 for (std::uint64_t i = 0; i < n; ++i) {
+                     keep(field.value);
+                     (identity.*field.field)().putCharVal(field.value);
+                     keep(buffer.data());
+                 }
+             }});
+    }
+
+    benchmarks.push_back({"request/decode", [](std::uint64_t n) {
+                              std::vector<char> request = make_request();
+                              for (std::uint64_t i = 0; i < n; ++i) {
+                                  IdentityRequest decoded;
+                                  decoded.decode(request.data(),
+                                                 request.size());
+                                  keep(decoded.fields);
+                              }
+                          }});
+
+    // What RequestHandler::get_buffer used to do, per response
+    benchmarks.push_back(
+        {"response/encode", [](std::uint64_t n) {
+             std::vector<char> request = make_request();
+             alignas(64) char response[response_encoder::RESPONSE_LENGTH];
+             for (std::uint64_t i = 0; i < n; ++i) {
+                 const std::uint8_t result = i & 1;
+                 response_encoder::encode(response, sizeof(response),
+                                          request.data(), request.size(),
+                                          &result, 1, i);
+                 keep(response);
+             }
+         }});
+
+    return benchmarks;
+}
+
+std::vector<Benchmark> helper_benchmarks() {
+    std::vector<Benchmark> benchmarks;
+
+    benchmarks.push_back({"helper/string_to_bool", [](std::uint64_t n) {
+                              const std::string value = "false";
+                              for (std::uint64_t i = 0; i < n; ++i) {
+                                  keep(value);
+                                  keep(string_to_bool(value));
+                              }
+                          }});
+    benchmarks.push_back({"helper/string_view_to_bool", [](std::uint64_t n) {
+                              const std::string_view value = "false";
+                              for (std::uint64_t i = 0; i < n; ++i) {
+                                  keep(value);
+                                  keep(string_view_to_bool(value));
+                              }
+                          }});
+    benchmarks.push_back({"helper/bool_to_string", [](std::uint64_t n) {
+                              for (std::uint64_t i = 0; i < n; ++i) {
+                                  std::string value = bool_to_string(i & 1);
+                                  keep(value);
+                              }
+                          }});
+    benchmarks.push_back({"helper/trim", [](std::uint64_t n) {
+                              const std::string padded = "  AB1234567  ";
+                              for (std::uint64_t i = 0; i < n; ++i) {
+                                  std::string value = padded;
+                                  trim(value);
+                                  keep(value);
+                              }
+                          }});
+
+    return benchmarks;
+}
+
+// Escape for a JSON string; names and host names are plain ASCII
+std::string json_string(const std::string &value) {
+    std::string escaped = "\"";
+    for (char c : value) {
+        if (c == '"' || c == '\\') escaped += '\\';
+        escaped += c;
+    }
+    return escaped + "\"";
+}
+
+void print_json(const std::vector<Result> &results) {
+    char host[256] = {};
+    gethostname(host, sizeof(host) - 1);
+    char date[64];
+    const std::time_t now = std::time(nullptr);
+    std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S%z",
+                  std::localtime(&now));
+
+    std::printf("{\n  \"context\": {\n");
+    std::printf("    \"date\": %s,\n", json_string(date).c_str());
+    std::printf("    \"host_name\": %s,\n", json_string(host).c_str());
+    std::printf("    \"num_cpus\": %u,\n",
+                std::thread::hardware_concurrency());
+#ifdef NDEBUG
+    std::printf("    \"library_build_type\": \"release\"\n");
+#else
+    std::printf("    \"library_build_type\": \"debug\"\n");
+#endif
+    std::printf("  },\n  \"benchmarks\": [\n");
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        const auto &result = results[i];
+        const std::string name = json_string(result.name);
+        std::printf("    {\n");
+        std::printf("      \"name\": %s,\n", name.c_str());
+        std::printf("      \"run_name\": %s,\n", name.c_str());
+        std::printf("      \"run_type\": \"iteration\",\n");
+        std::printf("      \"iterations\": %llu,\n",
+                    static_cast<unsigned long long>(result.iterations));
+        std::printf("      \"real_time\": %.4f,\n", result.realNs);
+        std::printf("      \"cpu_time\": %.4f,\n", result.cpuNs);
+        std::printf("      \"time_unit\": \"ns\"\n");
+        std::printf("    }%s\n", i + 1 < results.size() ? "," : "");
+    }
+    std::printf("  ]\n}\n");
+}
+
+void print_console(const Result &result) {
+    std::printf("%-32s %12.2f ns %12.2f ns cpu %14llu\n", result.name.c_str(),
+                result.realNs, result.cpuNs,
+                static_cast<unsigned long long>(result.iterations));
+    std::fflush(stdout);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    bool json = true;
+    std::string filter;
+    double minSeconds = 0.5;
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg = argv[i];
+        if (arg == "--format=json") {
+            json = true;
+        } else if (arg == "--format=console") {
+            json = false;
+        } else if (arg.substr(0, 9) == "--filter=") {
+            filter = std::string(arg.substr(9));
+        } else if (arg.substr(0, 11) == "--min-time=") {
+            minSeconds = std::strtod(argv[i] + 11, nullptr);
+        } else {
+            std::fprintf(stderr,
+                         "Usage: %s [--format=json|console] "
+                         "[--filter=SUBSTRING] [--min-time=SECONDS]\n",
+                         argv[0]);
+            return 2;
+        }
+    }
+
+    std::vector<Benchmark> benchmarks = codec_benchmarks();
+    for (auto &benchmark : helper_benchmarks())
+        benchmarks.push_back(std::move(benchmark));
+
+    std::vector<Result> results;
+    for (const auto &benchmark : benchmarks) {
+        if (benchmark.name.find(filter) == std::string::npos) continue;
+        results.push_back(run(benchmark, minSeconds));
+        if (!json) print_console(results.back());
+    }
+    if (json) print_json(results);
+    return 0;
+}
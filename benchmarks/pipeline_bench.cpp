@@ -0,0 +1,200 @@
+// Whole-engine throughput without a media driver or database: drives
+// IdentityMessage requests through eKYCEngine over a LoopbackTransport, from
+// the poller's receive_request through the shard rings and RequestHandler to
+// each shard's send_response, and reads the responses back in process.
+//
+// The identities are added first so the measured verifications are half
+// cache hits and half Bloom filter misses, the two paths answered from
+// memory. Settings come from config.txt as for the engine, except that
+// DB_BACKEND is forced to memory. Run from the build directory.
+//
+// Usage: pipeline_bench [messages] [identities]
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "Config.h"
+#include "LatencyHistogram.h"
+#include "Log.h"
+#include "LoopbackTransport.h"
+#include "RequestFixture.h"
+#include "eKYCEngine.h"
+#include "helper.h"
+#include "messages/IdentityMessage.h"
+#include "messages/MessageHeader.h"
+
+namespace {
+
+using request_fixture::REQUEST_LENGTH;
+
+// Adds wait for a batch to fill or SHARD_TIMEOUT_MS to pass
+constexpr auto RESPONSE_TIMEOUT = std::chrono::seconds(30);
+
+// A request template patched in place for every send
+class Requests final {
+   public:
+    Requests() {
+        request_fixture::fill(_identity, _buffer, sizeof(_buffer));
+    }
+
+    const char *next(bool add, std::uint64_t identity,
+                     std::uint64_t correlationId) {
+        request_fixture::set_add(_identity, add);
+        request_fixture::set_id(_identity, "PB", identity);
+        _identity.correlationId(correlationId);
+        _identity.clientSendTimeNs(epoch_nanos());
+        return _buffer;
+    }
+
+   private:
+    char _buffer[REQUEST_LENGTH];
+    messages::IdentityMessage _identity;
+};
+
+// Drains every shard's responses on its own thread
+class ResponseCounter final {
+   public:
+    explicit ResponseCounter(LoopbackTransport *transport)
+        : _transport(transport), _thread([this]() { run(); }) {}
+
+    ~ResponseCounter() {
+        _running = false;
+        _thread.join();
+    }
+
+    std::uint64_t received() const {
+        return _received.load(std::memory_order_acquire);
+    }
+    std::uint64_t verified() const {
+        return _verified.load(std::memory_order_acquire);
+    }
+    const LatencyHistogram &latencies() const { return _latencies; }
+
+    // Wait for total responses, false on timeout
+    bool wait_for(std::uint64_t total) const {
+        const auto deadline =
+            std::chrono::steady_clock::now() + RESPONSE_TIMEOUT;
+        while (received() < total) {
+            if (std::chrono::steady_clock::now() >= deadline) return false;
+            std::this_thread::yield();
+        }
+        return true;
+    }
+
+   private:
+    void run() {
+        auto handler = [this](char *buffer, std::size_t length) {
+            on_response(buffer, length);
+        };
+        while (_running.load(std::memory_order_relaxed)) {
+            if (_transport->poll_responses(handler, 64) == 0)
+                std::this_thread::yield();
+        }
+    }
+
+    void on_response(char *buffer, std::size_t length) {
+        const std::uint64_t nowNs = epoch_nanos();
+        messages::MessageHeader msgHeader(buffer, length);
+        messages::IdentityMessage identity;
+        identity.wrapForDecode(buffer, msgHeader.encodedLength(),
+                               msgHeader.blockLength(), msgHeader.version(),
+                               length);
+        const std::uint64_t sentNs = identity.clientSendTimeNs();
+        _latencies.record(nowNs > sentNs ? nowNs - sentNs : 0);
+        if (identity.isVerified() == messages::BooleanType::T)
+            _verified.fetch_add(1, std::memory_order_release);
+        _received.fetch_add(1, std::memory_order_release);
+    }
+
+    LoopbackTransport *_transport;
+    std::atomic<bool> _running{true};
+    std::atomic<std::uint64_t> _received{0};
+    std::atomic<std::uint64_t> _verified{0};
+    LatencyHistogram _latencies;
+    std::thread _thread;
+};
+
+void offer(LoopbackTransport *transport, const char *request) {
+    while (!transport->offer(request, REQUEST_LENGTH))
+        std::this_thread::yield();
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    const std::uint64_t messages =
+        argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 5000000;
+    const std::uint64_t identities =
+        argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 10000;
+    if (messages == 0 || identities == 0) {
+        std::fprintf(stderr, "Usage: %s [messages] [identities]\n", argv[0]);
+        return 2;
+    }
+
+    auto &cfg = Config::get();
+    logging::set_level(logging::parse_level(cfg.LOG_LEVEL));
+    qLogger::get().initialize("logs/pipeline_bench.log", LogLevel::DEBUG);
+    cfg.DB_BACKEND = "memory";
+
+    const auto numShards =
+        static_cast<std::uint32_t>(std::max(cfg.NUM_SHARDS, 1));
+    auto loopback = std::make_unique<LoopbackTransport>(
+        cfg.MAX_RING_BUFFER_SIZE, numShards);
+    LoopbackTransport *transport = loopback.get();
+    eKYCEngine engine(std::move(loopback));
+    engine.start();
+
+    Requests requests;
+    std::uint64_t correlationId = 0;
+    {
+        ResponseCounter responses(transport);
+        for (std::uint64_t i = 0; i < identities; ++i)
+            offer(transport, requests.next(true, i, ++correlationId));
+        if (!responses.wait_for(identities)) {
+            std::fprintf(stderr, "Timed out adding identities\n");
+            return 1;
+        }
+        std::printf("added    %llu identities across %u shards\n",
+                    static_cast<unsigned long long>(responses.verified()),
+                    numShards);
+    }
+
+    ResponseCounter responses(transport);
+    const auto start = std::chrono::steady_clock::now();
+    for (std::uint64_t i = 0; i < messages; ++i) {
+        // Even: a known identity, odd: one never added
+        const std::uint64_t identity =
+            (i & 1) == 0 ? (i / 2) % identities : identities + i / 2;
+        offer(transport, requests.next(false, identity, ++correlationId));
+    }
+    const bool complete = responses.wait_for(messages);
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    engine.stop();
+
+    const double seconds = std::chrono::duration<double>(elapsed).count();
+    std::printf("verified %llu of %llu in %.3f s, %.0f messages/s, "
+                "%.1f ns/message\n",
+                static_cast<unsigned long long>(responses.received()),
+                static_cast<unsigned long long>(messages), seconds,
+                responses.received() / seconds,
+                seconds * 1e9 / static_cast<double>(messages));
+    std::printf("found    %llu (expected %llu)\n",
+                static_cast<unsigned long long>(responses.verified()),
+                static_cast<unsigned long long>((messages + 1) / 2));
+
+    LatencyHistogram::Counts counts{};
+    responses.latencies().add_to(counts);
+    std::printf("latency  p50 %.1f  p99 %.1f  p99.9 %.1f  max %.1f us\n",
+                LatencyHistogram::percentile(counts, 50.0) / 1000.0,
+                LatencyHistogram::percentile(counts, 99.0) / 1000.0,
+                LatencyHistogram::percentile(counts, 99.9) / 1000.0,
+                LatencyHistogram::max(counts) / 1000.0);
+    return complete ? 0 : 1;
+}
@@ -0,0 +1,116 @@
+// Per-response encode cost of three encoders: the original one that
+// allocated a buffer per response and round-tripped every field through
+// std::string, field by field string_view copies, and the block copy used by
+// RequestHandler::encode_response.
+//
+// Usage: response_encode_bench [iterations]
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string_view>
+#include <vector>
+
+#include "RequestFixture.h"
+#include "ResponseEncoder.h"
+#include "messages/IdentityMessage.h"
+#include "messages/MessageHeader.h"
+
+namespace {
+
+// Keep the compiler from discarding the encoded bytes
+inline void clobber(void *p) { asm volatile("" : : "g"(p) : "memory"); }
+
+// The encoder before responses were written in place: a heap buffer per
+// response and a std::string per echoed field
+void encode_baseline(messages::IdentityMessage &original, bool verified) {
+    using namespace messages;
+    std::vector<char> buffer(response_encoder::RESPONSE_LENGTH);
+
+    MessageHeader msgHeader;
+    msgHeader.wrap(buffer.data(), 0, 0, buffer.size());
+    msgHeader.blockLength(IdentityMessage::sbeBlockLength());
+    msgHeader.templateId(IdentityMessage::sbeTemplateId());
+    msgHeader.schemaId(IdentityMessage::sbeSchemaId());
+    msgHeader.version(IdentityMessage::sbeSchemaVersion());
+
+    IdentityMessage identity;
+    identity.wrapForEncode(buffer.data(), msgHeader.encodedLength(),
+                           buffer.size());
+    identity.msg().putCharVal(response_encoder::RESPONSE_MSG);
+    identity.type().putCharVal(original.type().getCharValAsString());
+    identity.id().putCharVal(original.id().getCharValAsString());
+    identity.name().putCharVal(original.name().getCharValAsString());
+    identity.dateOfIssue().putCharVal(
+        original.dateOfIssue().getCharValAsString());
+    identity.dateOfExpiry().putCharVal(
+        original.dateOfExpiry().getCharValAsString());
+    identity.address().putCharVal(original.address().getCharValAsString());
+    identity.verified().putCharVal(verified ? std::string_view("true")
+                                            : std::string_view("false"));
+    clobber(buffer.data());
+}
+
+template <typename Encode>
+double run(const char *label, std::uint64_t iterations, Encode &&encode) {
+    std::vector<char> request = request_fixture::make_request();
+    messages::MessageHeader msgHeader(request.data(), request.size());
+    messages::IdentityMessage identity;
+    identity.wrapForDecode(request.data(), msgHeader.encodedLength(),
+                           msgHeader.blockLength(), msgHeader.version(),
+                           request.size());
+
+    alignas(64) char response[response_encoder::RESPONSE_LENGTH];
+
+    // Warm up caches and branch predictors
+    for (std::uint64_t i = 0; i < iterations / 10 + 1; ++i) {
+        encode(response, sizeof(response), identity, (i & 1) != 0);
+        clobber(response);
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    for (std::uint64_t i = 0; i < iterations; ++i) {
+        encode(response, sizeof(response), identity, (i & 1) != 0);
+        clobber(response);
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    const double nsPerOp =
+        std::chrono::duration<double, std::nano>(elapsed).count() /
+        static_cast<double>(iterations);
+    std::printf("%-8s %12llu iterations %10.2f ns/response\n", label,
+                static_cast<unsigned long long>(iterations), nsPerOp);
+    return nsPerOp;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    const std::uint64_t iterations =
+        argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 5000000;
+
+    const double baseline = run(
+        "baseline", iterations,
+        [](char *, std::size_t, messages::IdentityMessage &request,
+           bool verified) { encode_baseline(request, verified); });
+    const double fields = run(
+        "fields", iterations,
+        [](char *buffer, std::size_t length,
+           messages::IdentityMessage &request, bool verified) {
+            response_encoder::encode_fields(buffer, length, request, verified,
+                                            0);
+        });
+    const double block = run(
+        "block", iterations,
+        [](char *buffer, std::size_t length,
+           messages::IdentityMessage &request, bool verified) {
+            response_encoder::encode_block(buffer, length, request, verified,
+                                           0);
+        });
+
+    std::printf("block vs baseline %.2fx, block vs fields %.2fx\n",
+                baseline / block, fields / block);
+    return 0;
+}
@@ -0,0 +1,99 @@
+#include "AeronTransport.h"
+
+#include <string>
+
+#include "Config.h"
+#include "Log.h"
+
+namespace {
+
+SendResult send_result(aeron_wrapper::PublicationResult result) noexcept {
+    using aeron_wrapper::PublicationResult;
+    switch (result) {
+        case PublicationResult::SUCCESS:
+            return SendResult::SUCCESS;
+        case PublicationResult::NOT_CONNECTED:
+            return SendResult::NOT_CONNECTED;
+        case PublicationResult::BACK_PRESSURED:
+            return SendResult::BACK_PRESSURED;
+        case PublicationResult::ADMIN_ACTION:
+            return SendResult::ADMIN_ACTION;
+        case PublicationResult::CLOSED:
+            return SendResult::CLOSED;
+        case PublicationResult::MAX_POSITION_EXCEEDED:
+            return SendResult::MAX_POSITION_EXCEEDED;
+        default:
+            return SendResult::ERROR;
+    }
+}
+
+// Claims from the shared publication or the shard's own; the claim itself
+// always belongs to this shard
+class AeronPublisher final : public ResponsePublisher {
+   public:
+    explicit AeronPublisher(aeron_wrapper::Publication *publication) noexcept
+        : _publication(publication) {}
+
+    SendResult try_claim(std::size_t length, char *&buffer) override {
+        const SendResult result =
+            send_result(_publication->try_claim(length, _claim));
+        if (result == SendResult::SUCCESS)
+            buffer = reinterpret_cast<char *>(_claim.buffer().buffer()) +
+                     _claim.offset();
+        return result;
+    }
+
+    void commit() noexcept override { _claim.commit(); }
+
+    // Aborted claims are skipped by subscribers as padding
+    void abort() noexcept override { _claim.abort(); }
+
+   private:
+    aeron_wrapper::Publication *_publication;
+    aeron::concurrent::logbuffer::BufferClaim _claim;
+};
+
+}  // namespace
+
+AeronTransport::AeronTransport() {
+    auto &cfg = Config::get();
+    _aeron = std::make_unique<aeron_wrapper::Aeron>(cfg.AERON_DIR);
+    EKYC_LOG_INFO("Connected to Aeron Media Driver...");
+    std::string subscriptionChannel =
+        "aeron:" + cfg.AERON_PROTOCOL + "?endpoint=" + cfg.SUBSCRIPTION_IP +
+        ":" + std::to_string(cfg.SUBSCRIPTION_PORT);
+    _subscription = _aeron->create_subscription(subscriptionChannel,  //
+                                                cfg.SUBSCRIPTION_STREAM_ID);
+    _publicationChannel = "aeron:" + cfg.AERON_PROTOCOL +
+                          "?endpoint=" + cfg.PUBLICATION_IP + ":" +
+                          std::to_string(cfg.PUBLICATION_PORT);
+    if (!cfg.PUBLICATION_PER_SHARD)
+        _publication = _aeron->create_publication(_publicationChannel,  //
+                                                  cfg.PUBLICATION_STREAM_ID);
+
+    _fragmentHandler = [this](const aeron_wrapper::FragmentData &fragment) {
+        char *buffer = reinterpret_cast<char *>(
+                           const_cast<uint8_t *>(
+                               fragment.atomicBuffer.buffer())) +
+                       fragment.offset;
+        (*_handler)(buffer, static_cast<std::size_t>(fragment.length));
+    };
+}
+
+int AeronTransport::poll(const FragmentHandler &handler, int fragmentLimit) {
+    _handler = &handler;
+    return _subscription->poll(_fragmentHandler, fragmentLimit);
+}
+
+std::unique_ptr<ResponsePublisher> AeronTransport::publisher(
+    std::uint32_t shardId) {
+    if (_publication)
+        return std::make_unique<AeronPublisher>(_publication.get());
+
+    const std::int32_t streamId = Config::get().PUBLICATION_STREAM_ID +
+                                  static_cast<std::int32_t>(shardId);
+    _shardPublications.push_back(
+        _aeron->create_publication(_publicationChannel, streamId));
+    EKYC_LOG_INFO("Shard {} publishing on stream {}", shardId, streamId);
+    return std::make_unique<AeronPublisher>(_shardPublications.back().get());
+}
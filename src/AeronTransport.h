@@ -0,0 +1,47 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Transport.h"
+#include "aeron_wrapper.h"
+
+// Requests from the subscription and responses to the publication configured
+// by the AERON_* and *_IP/_PORT/_STREAM_ID settings. Every shard claims from
+// the one shared publication, or with PUBLICATION_PER_SHARD from its own on
+// stream PUBLICATION_STREAM_ID + shard id, so shards never contend on a
+// publication's tail and the stream tells a client which shard answered.
+class AeronTransport final : public Transport {
+   public:
+    // Connects to the media driver, throws on failure
+    AeronTransport();
+    ~AeronTransport() noexcept override = default;
+
+    AeronTransport(const AeronTransport &) noexcept = delete;
+    AeronTransport &operator=(const AeronTransport &) noexcept = delete;
+    AeronTransport(AeronTransport &&) noexcept = delete;
+    AeronTransport &operator=(AeronTransport &&) noexcept = delete;
+
+    const char *name() const noexcept override { return "aeron"; }
+
+    int poll(const FragmentHandler &handler, int fragmentLimit) override;
+
+    // Called once per shard; with PUBLICATION_PER_SHARD each call adds the
+    // shard's publication
+    std::unique_ptr<ResponsePublisher> publisher(
+        std::uint32_t shardId) override;
+
+   private:
+    std::unique_ptr<aeron_wrapper::Aeron> _aeron;
+    std::unique_ptr<aeron_wrapper::Subscription> _subscription;
+    std::string _publicationChannel;
+    // Shared by all shards, null with PUBLICATION_PER_SHARD
+    std::unique_ptr<aeron_wrapper::Publication> _publication;
+    std::vector<std::unique_ptr<aeron_wrapper::Publication>> _shardPublications;
+
+    // Adapts Aeron fragments to the handler of the poll() in progress, built
+    // once so polling does not construct a std::function every time
+    aeron_wrapper::FragmentHandler _fragmentHandler;
+    const FragmentHandler *_handler = nullptr;
+};
@@ -0,0 +1,82 @@
+#include "AllocationCheck.h"
+
+#ifdef EKYC_CHECK_ALLOCATIONS
+
+#include <cassert>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+thread_local std::uint64_t t_allocations = 0;
+thread_local AllocationCheck* t_active = nullptr;
+
+void* counted_malloc(std::size_t size) noexcept {
+    ++t_allocations;
+    return std::malloc(size == 0 ? 1 : size);
+}
+
+}  // namespace
+
+AllocationCheck::AllocationCheck() noexcept
+    : _allocations(t_allocations), _outer(t_active), _allowed(false) {
+    t_active = this;
+}
+
+AllocationCheck::~AllocationCheck() noexcept {
+    t_active = _outer;
+    if (_allowed) {
+        // Discount the exempted allocations from the enclosing check
+        if (_outer) _outer->_allocations += t_allocations - _allocations;
+        return;
+    }
+    // The scope allocated without calling allow()
+    assert(t_allocations == _allocations);
+}
+
+std::uint64_t AllocationCheck::thread_allocations() noexcept {
+    return t_allocations;
+}
+
+void AllocationCheck::allow() noexcept {
+    if (t_active) t_active->_allowed = true;
+}
+
+// Replaceable allocation functions. The aligned overloads keep their default
+// implementations, which do not route through these.
+void* operator new(std::size_t size) {
+    void* p = counted_malloc(size);
+    if (!p) throw std::bad_alloc();
+    return p;
+}
+
+void* operator new[](std::size_t size) {
+    void* p = counted_malloc(size);
+    if (!p) throw std::bad_alloc();
+    return p;
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    return counted_malloc(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    return counted_malloc(size);
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+
+void operator delete[](void* p) noexcept { std::free(p); }
+
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+
+void operator delete(void* p, const std::nothrow_t&) noexcept { std::free(p); }
+
+void operator delete[](void* p, const std::nothrow_t&) noexcept {
+    std::free(p);
+}
+
+#endif
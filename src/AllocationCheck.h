@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstdint>
+
+// Debug-build proof that a scope never touches the heap.
+//
+// With EKYC_CHECK_ALLOCATIONS defined (CMake Debug builds), the global
+// operator new counts allocations per thread and an AllocationCheck asserts
+// on destruction that its thread did not allocate while it was alive, unless
+// allow() was called meanwhile. Otherwise it compiles away entirely.
+class AllocationCheck final {
+   public:
+#ifdef EKYC_CHECK_ALLOCATIONS
+    AllocationCheck() noexcept;
+    ~AllocationCheck() noexcept;
+
+    // Allocations made by the calling thread so far
+    static std::uint64_t thread_allocations() noexcept;
+
+    // Exempt the innermost active check of the calling thread, for paths
+    // that legitimately allocate such as DB round trips. The checks around
+    // it exempt what it allocated, but not their own allocations outside it.
+    static void allow() noexcept;
+#else
+    // User-provided so a lone guard does not warn as unused
+    AllocationCheck() noexcept {}
+
+    static void allow() noexcept {}
+#endif
+
+    AllocationCheck(const AllocationCheck&) noexcept = delete;
+    AllocationCheck& operator=(const AllocationCheck&) noexcept = delete;
+    AllocationCheck(AllocationCheck&&) noexcept = delete;
+    AllocationCheck& operator=(AllocationCheck&&) noexcept = delete;
+
+#ifdef EKYC_CHECK_ALLOCATIONS
+   private:
+    std::uint64_t _allocations;
+    AllocationCheck* _outer;
+    bool _allowed;
+#endif
+};
@@ -0,0 +1,97 @@
+#include "BloomFilter.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "helper.h"
+
+namespace {
+
+const double LN2 = std::log(2.0);
+
+// k = m / n ln(2)
+std::size_t optimal_hash_count(double bitsPerItem) noexcept {
+    return std::clamp<std::size_t>(
+        static_cast<std::size_t>(std::round(bitsPerItem * LN2)), 1, 16);
+}
+
+}  // namespace
+
+// Items per block are Poisson distributed around the mean, and the blocks
+// that happen to be crowded answer worse than the classic formula assumes
+double BloomFilter::blocked_fp_rate(double itemsPerBlock,
+                                    std::size_t hashCount) noexcept {
+    const auto lastCount = static_cast<std::size_t>(
+        itemsPerBlock + 12 * std::sqrt(itemsPerBlock) + 16);
+    const double k = static_cast<double>(hashCount);
+    double probability = std::exp(-itemsPerBlock);
+    double rate = 0.0;
+    for (std::size_t count = 0; count <= lastCount; ++count) {
+        if (count != 0) probability *= itemsPerBlock / count;
+        const double bitSet =
+            1.0 - std::pow(1.0 - 1.0 / BLOCK_BITS, k * count);
+        rate += probability * std::pow(bitSet, k);
+    }
+    return rate;
+}
+
+BloomFilter::BloomFilter(std::size_t expectedItems, double falsePositiveRate)
+    : _hashCount(1), _itemCount(0) {
+    const double items =
+        static_cast<double>(std::max<std::size_t>(expectedItems, 1));
+    const double rate = std::clamp(falsePositiveRate, 1e-9, 0.5);
+
+    // Start from the classic optimum m = -n ln(p) / ln(2)^2, then add blocks
+    // until the blocked filter itself meets the target
+    const double bits = -items * std::log(rate) / (LN2 * LN2);
+    std::size_t blockCount = std::max<std::size_t>(
+        1, static_cast<std::size_t>(std::ceil(bits / BLOCK_BITS)));
+    while (true) {
+        _hashCount = optimal_hash_count(
+            static_cast<double>(blockCount * BLOCK_BITS) / items);
+        if (blocked_fp_rate(items / static_cast<double>(blockCount),
+                            _hashCount) <= rate)
+            break;
+        blockCount += std::max<std::size_t>(1, blockCount / 16);
+    }
+
+    _blocks.assign(blockCount, Block{});
+}
+
+void BloomFilter::add(std::string_view key) noexcept {
+    const std::uint64_t hash = hash_key(key);
+    Block &block = _blocks[block_index(hash)];
+
+    std::uint64_t probe = probe_seed(hash);
+    for (std::size_t i = 0; i < _hashCount; ++i) {
+        const std::uint32_t index = next_bit(probe);
+        block.words[index / 64] |= std::uint64_t{1} << (index % 64);
+    }
+    ++_itemCount;
+}
+
+bool BloomFilter::might_contain(std::string_view key) const noexcept {
+    const std::uint64_t hash = hash_key(key);
+    const Block &block = _blocks[block_index(hash)];
+
+    std::uint64_t probe = probe_seed(hash);
+    for (std::size_t i = 0; i < _hashCount; ++i) {
+        const std::uint32_t index = next_bit(probe);
+        if ((block.words[index / 64] & (std::uint64_t{1} << (index % 64))) ==
+            0)
+            return false;
+    }
+    return true;
+}
+
+// Shards already partition by hash_bytes, remix so the block index does not
+// inherit that bias
+std::uint64_t BloomFilter::hash_key(std::string_view key) noexcept {
+    std::uint64_t hash = hash_bytes(key.data(), key.size());
+    hash ^= hash >> 33;
+    hash *= 0xFF51AFD7ED558CCDULL;
+    hash ^= hash >> 33;
+    hash *= 0xC4CEB9FE1A85EC53ULL;
+    hash ^= hash >> 33;
+    return hash;
+}
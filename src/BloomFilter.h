@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+// Blocked Bloom filter: every key maps to a single 64-byte block and sets all
+// of its bits there, so a lookup costs one cache miss whatever the number of
+// hash functions. Sized from the expected number of keys and the target
+// false-positive rate, allowing for the uneven fill of the blocks.
+class BloomFilter final {
+   public:
+    // Throws std::bad_alloc (or std::length_error for an absurd size) if the
+    // blocks cannot be allocated
+    BloomFilter(std::size_t expectedItems, double falsePositiveRate);
+
+    ~BloomFilter() noexcept = default;
+
+    void add(std::string_view key) noexcept;
+
+    // false means the key was definitely never added
+    bool might_contain(std::string_view key) const noexcept;
+
+    std::size_t size_in_bytes() const noexcept {
+        return _blocks.size() * sizeof(Block);
+    }
+
+    std::size_t hash_count() const noexcept { return _hashCount; }
+
+    std::size_t item_count() const noexcept { return _itemCount; }
+
+   private:
+    static constexpr std::size_t BLOCK_BITS = 512;
+    static_assert(BLOCK_BITS == 1 << 9, "next_bit() yields 9-bit positions");
+
+    struct alignas(64) Block {
+        std::uint64_t words[BLOCK_BITS / 64];
+    };
+
+    static std::uint64_t hash_key(std::string_view key) noexcept;
+    static double blocked_fp_rate(double itemsPerBlock,
+                                  std::size_t hashCount) noexcept;
+
+    // The block comes from the high 32 bits of the hash and the bits set in
+    // it from the low 32, so they are independent of which block was chosen.
+    // Each probe steps a 64-bit LCG seeded from those bits and takes its top
+    // 9 bits: independent positions, unlike double hashing, under which keys
+    // sharing a step shadow each other within the block.
+    std::size_t block_index(std::uint64_t hash) const noexcept {
+        return static_cast<std::size_t>(hash >> 32) % _blocks.size();
+    }
+    static std::uint64_t probe_seed(std::uint64_t hash) noexcept {
+        return static_cast<std::uint32_t>(hash);
+    }
+    static std::uint32_t next_bit(std::uint64_t &probe) noexcept {
+        probe = probe * 0x5851F42D4C957F2DULL + 0x14057B7EF767814FULL;
+        return static_cast<std::uint32_t>(probe >> 55);
+    }
+
+    std::vector<Block> _blocks;
+    std::size_t _hashCount;
+    std::size_t _itemCount;
+};
@@ -1,5 +1,6 @@
 #pragma once
 #include <algorithm>
+#include <cstdint>
 #include <fstream>
 #include <sstream>
 #include <stdexcept>
@@ -12,6 +13,8 @@ class Config final {
     // Logging
     std::string LOG_DIR;
     size_t ROTATIING_LOG_SIZE;
+    // DEBUG | INFO | WARNING | ERROR, on top of the EKYC_LOG_LEVEL build floor
+    std::string LOG_LEVEL = "DEBUG";
 
     // Sharding
     int NUM_SHARDS;
@@ -26,18 +29,71 @@ class Config final {
     int PUBLICATION_PORT;
     int SUBSCRIPTION_STREAM_ID;
     int PUBLICATION_STREAM_ID;
+    // Each shard publishes on stream PUBLICATION_STREAM_ID + shard id
+    bool PUBLICATION_PER_SHARD = false;
 
-    // Database
+    // Database: postgresql | memory, the latter for DB-free load tests
+    std::string DB_BACKEND = "postgresql";
+    // Delay per statement of the memory backend, standing in for a round trip
+    int DB_MEMORY_LATENCY_US = 0;
     std::string DB_HOST;
     int DB_PORT;
     std::string DB_NAME;
     std::string DB_USER;
     std::string DB_PASSWORD;
 
+    // This engine is the only writer of the users table: no other instance,
+    // admin tool or script inserts into it. Needed with postgresql before a
+    // Bloom filter miss is answered without asking the DB.
+    bool DB_SINGLE_WRITER = false;
+
+    // Bloom filter over identity numbers, sized for the whole table
+    bool BLOOM_FILTER_ENABLED = true;
+    size_t BLOOM_FILTER_EXPECTED_ITEMS = 1000000;
+    double BLOOM_FILTER_FP_RATE = 0.01;
+
+    // Binary per-request journal, one rotating set of files per shard
+    bool JOURNAL_ENABLED = true;
+    std::string JOURNAL_DIR = "../logs/journal";
+    size_t JOURNAL_FILE_SIZE = 64 * 1024 * 1024;
+    size_t JOURNAL_MAX_FILES = 8;
+
+    // Per-stage latency histograms, reported every interval to the log and
+    // appended to LATENCY_REPORT_FILE unless empty
+    bool LATENCY_STATS_ENABLED = true;
+    int LATENCY_REPORT_INTERVAL_MS = 10000;
+    std::string LATENCY_REPORT_FILE;
+
+    // Shared-memory counters read by ekyc_stat, empty keeps them in-process
+    std::string COUNTERS_FILE = "/dev/shm/ekyc-counters";
+
     // Performance tuning
     int SHARD_TIMEOUT_MS;
     int IDLE_STRATEGY_SPINS;
     int IDLE_STRATEGY_YIELDS;
+    // Verifications resolved per DB query, the first waiting at most
+    // VERIFY_BATCH_MAX_WAIT_MS for the batch to fill
+    size_t VERIFY_BATCH_SIZE = 64;
+    int VERIFY_BATCH_MAX_WAIT_MS = 50;
+    // Longest a VerifyBatchRequest waits for the shards owning its entries
+    // to answer what they received before it
+    int VERIFY_GROUP_DRAIN_TIMEOUT_MS = 1000;
+    // Adds written per multi-row INSERT, same wait bound
+    size_t ADD_BATCH_SIZE = 256;
+    std::int64_t IDLE_STRATEGY_MIN_PARK_NS = 1000;
+    std::int64_t IDLE_STRATEGY_MAX_PARK_NS = 100000;
+    std::int64_t IDLE_STRATEGY_SLEEP_NS = 1000000;
+    // busy_spin | backoff | sleeping | noop
+    std::string POLLER_IDLE_STRATEGY = "backoff";
+    std::string WORKER_IDLE_STRATEGY = "backoff";
+
+    // A response refused by back pressure is retried with
+    // PUBLISH_IDLE_STRATEGY for up to PUBLISH_RETRY_TIMEOUT_US, then queued in
+    // OUTBOUND_QUEUE_SIZE bytes per shard until the publication catches up;
+    // 0 skips the retries or the queue, and what fits nowhere is dropped
+    std::int64_t PUBLISH_RETRY_TIMEOUT_US = 100;
+    std::string PUBLISH_IDLE_STRATEGY = "backoff";
+    size_t OUTBOUND_QUEUE_SIZE = 1048576;
 
     static Config& get() {
         static Config config;
@@ -89,6 +145,8 @@ class Config final {
             LOG_DIR = value;
         else if (key == "ROTATIING_LOG_SIZE")
             ROTATIING_LOG_SIZE = std::stoull(value);
+        else if (key == "LOG_LEVEL")
+            LOG_LEVEL = value;
         else if (key == "NUM_SHARDS")
             NUM_SHARDS = std::stoi(value);
         else if (key == "MAX_RING_BUFFER_SIZE")
@@ -109,6 +167,12 @@ class Config final {
             SUBSCRIPTION_STREAM_ID = std::stoi(value);
         else if (key == "PUBLICATION_STREAM_ID")
             PUBLICATION_STREAM_ID = std::stoi(value);
+        else if (key == "PUBLICATION_PER_SHARD")
+            PUBLICATION_PER_SHARD = string_to_bool(value);
+        else if (key == "DB_BACKEND")
+            DB_BACKEND = value;
+        else if (key == "DB_MEMORY_LATENCY_US")
+            DB_MEMORY_LATENCY_US = std::stoi(value);
         else if (key == "DB_HOST")
             DB_HOST = value;
         else if (key == "DB_PORT")
@@ -119,11 +183,59 @@ class Config final {
             DB_USER = value;
         else if (key == "DB_PASSWORD")
             DB_PASSWORD = value;
+        else if (key == "DB_SINGLE_WRITER")
+            DB_SINGLE_WRITER = string_to_bool(value);
+        else if (key == "BLOOM_FILTER_ENABLED")
+            BLOOM_FILTER_ENABLED = string_to_bool(value);
+        else if (key == "BLOOM_FILTER_EXPECTED_ITEMS")
+            BLOOM_FILTER_EXPECTED_ITEMS = std::stoull(value);
+        else if (key == "BLOOM_FILTER_FP_RATE")
+            BLOOM_FILTER_FP_RATE = std::stod(value);
+        else if (key == "JOURNAL_ENABLED")
+            JOURNAL_ENABLED = string_to_bool(value);
+        else if (key == "JOURNAL_DIR")
+            JOURNAL_DIR = value;
+        else if (key == "JOURNAL_FILE_SIZE")
+            JOURNAL_FILE_SIZE = std::stoull(value);
+        else if (key == "JOURNAL_MAX_FILES")
+            JOURNAL_MAX_FILES = std::stoull(value);
+        else if (key == "LATENCY_STATS_ENABLED")
+            LATENCY_STATS_ENABLED = string_to_bool(value);
+        else if (key == "LATENCY_REPORT_INTERVAL_MS")
+            LATENCY_REPORT_INTERVAL_MS = std::stoi(value);
+        else if (key == "LATENCY_REPORT_FILE")
+            LATENCY_REPORT_FILE = value;
+        else if (key == "COUNTERS_FILE")
+            COUNTERS_FILE = value;
         else if (key == "SHARD_TIMEOUT_MS")
             SHARD_TIMEOUT_MS = std::stoi(value);
         else if (key == "IDLE_STRATEGY_SPINS")
             IDLE_STRATEGY_SPINS = std::stoi(value);
         else if (key == "IDLE_STRATEGY_YIELDS")
             IDLE_STRATEGY_YIELDS = std::stoi(value);
+        else if (key == "VERIFY_BATCH_SIZE")
+            VERIFY_BATCH_SIZE = std::stoull(value);
+        else if (key == "VERIFY_BATCH_MAX_WAIT_MS")
+            VERIFY_BATCH_MAX_WAIT_MS = std::stoi(value);
+        else if (key == "VERIFY_GROUP_DRAIN_TIMEOUT_MS")
+            VERIFY_GROUP_DRAIN_TIMEOUT_MS = std::stoi(value);
+        else if (key == "ADD_BATCH_SIZE")
+            ADD_BATCH_SIZE = std::stoull(value);
+        else if (key == "IDLE_STRATEGY_MIN_PARK_NS")
+            IDLE_STRATEGY_MIN_PARK_NS = std::stoll(value);
+        else if (key == "IDLE_STRATEGY_MAX_PARK_NS")
+            IDLE_STRATEGY_MAX_PARK_NS = std::stoll(value);
+        else if (key == "IDLE_STRATEGY_SLEEP_NS")
+            IDLE_STRATEGY_SLEEP_NS = std::stoll(value);
+        else if (key == "POLLER_IDLE_STRATEGY")
+            POLLER_IDLE_STRATEGY = value;
+        else if (key == "WORKER_IDLE_STRATEGY")
+            WORKER_IDLE_STRATEGY = value;
+        else if (key == "PUBLISH_RETRY_TIMEOUT_US")
+            PUBLISH_RETRY_TIMEOUT_US = std::stoll(value);
+        else if (key == "PUBLISH_IDLE_STRATEGY")
+            PUBLISH_IDLE_STRATEGY = value;
+        else if (key == "OUTBOUND_QUEUE_SIZE")
+            OUTBOUND_QUEUE_SIZE = std::stoull(value);
     }
 };
@@ -0,0 +1,80 @@
+#include "CountersFile.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+
+#include "Log.h"
+#include "helper.h"
+
+CountersFile::CountersFile(const std::string& path,
+                           std::size_t shardCount) noexcept
+    : _shardCount(shardCount), _length(counters::file_length(shardCount)) {
+    int fd = -1;
+    if (!path.empty()) {
+        // Recreated rather than reused, so a stale layout is never mixed in
+        ::unlink(path.c_str());
+        fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+        if (fd < 0 || ::ftruncate(fd, static_cast<off_t>(_length)) != 0) {
+            EKYC_LOG_ERROR("Cannot create counters file {}: {}", path,
+                           std::strerror(errno));
+            if (fd >= 0) ::close(fd);
+            fd = -1;
+        }
+    }
+
+    if (fd >= 0) {
+        _mapping = ::mmap(nullptr, _length, PROT_READ | PROT_WRITE,
+                          MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (_mapping == MAP_FAILED) {
+            EKYC_LOG_ERROR("Cannot map counters file {}: {}", path,
+                           std::strerror(errno));
+            _mapping = nullptr;
+        }
+    }
+
+    if (!_mapping) {
+        // Zero-filled like a new file
+        _mapping = ::mmap(nullptr, _length, PROT_READ | PROT_WRITE,
+                          MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (_mapping == MAP_FAILED) {
+            // Out of address space already, nothing sensible left to do
+            EKYC_LOG_ERROR("Cannot allocate counters: {}",
+                           std::strerror(errno));
+            std::abort();
+        }
+    }
+
+    auto* header = static_cast<counters::CountersHeader*>(_mapping);
+    header->version = counters::VERSION;
+    header->pid = static_cast<std::uint32_t>(::getpid());
+    header->globalCounterCount = counters::GLOBAL_COUNTER_COUNT;
+    header->shardCounterCount = counters::SHARD_COUNTER_COUNT;
+    header->shardCount = static_cast<std::uint32_t>(_shardCount);
+    header->startNs = epoch_nanos();
+    // Last, readers check it before trusting the rest of the header
+    std::atomic_thread_fence(std::memory_order_release);
+    std::memcpy(header->magic, counters::MAGIC, sizeof(header->magic));
+}
+
+CountersFile::~CountersFile() noexcept { ::munmap(_mapping, _length); }
+
+CounterSet CountersFile::global() noexcept {
+    return CounterSet(first_counter());
+}
+
+CounterSet CountersFile::shard(std::size_t shardId) noexcept {
+    return CounterSet(first_counter() + counters::GLOBAL_COUNTER_COUNT +
+                      shardId * counters::SHARD_COUNTER_COUNT);
+}
+
+counters::Counter* CountersFile::first_counter() noexcept {
+    return reinterpret_cast<counters::Counter*>(
+        static_cast<char*>(_mapping) + sizeof(counters::CountersHeader));
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "CountersLayout.h"
+
+// A run of counters with a single writing thread. Updates are a relaxed load
+// and store, readers in this or another process may load at any time.
+class CounterSet final {
+   public:
+    explicit CounterSet(counters::Counter* counters) noexcept
+        : _counters(counters) {}
+
+    void increment(std::size_t id) noexcept { add(id, 1); }
+
+    void add(std::size_t id, std::uint64_t delta) noexcept {
+        auto& value = _counters[id].value;
+        value.store(value.load(std::memory_order_relaxed) + delta,
+                    std::memory_order_relaxed);
+    }
+
+    void set(std::size_t id, std::uint64_t value) noexcept {
+        _counters[id].value.store(value, std::memory_order_relaxed);
+    }
+
+    std::uint64_t get(std::size_t id) const noexcept {
+        return _counters[id].value.load(std::memory_order_relaxed);
+    }
+
+   private:
+    counters::Counter* _counters;
+};
+
+// The engine's counters region, a file mapped shared so ekyc_stat can read it
+// live (see CountersLayout.h). If the file cannot be mapped the counters live
+// in private memory instead, so counting never fails. The file is left behind
+// on exit for post-mortem reading and recreated on the next start.
+class CountersFile final {
+   public:
+    CountersFile(const std::string& path, std::size_t shardCount) noexcept;
+    ~CountersFile() noexcept;
+
+    CountersFile(const CountersFile&) noexcept = delete;
+    CountersFile& operator=(const CountersFile&) noexcept = delete;
+    CountersFile(CountersFile&&) noexcept = delete;
+    CountersFile& operator=(CountersFile&&) noexcept = delete;
+
+    // For the poller thread
+    CounterSet global() noexcept;
+    // For the worker of shardId
+    CounterSet shard(std::size_t shardId) noexcept;
+
+   private:
+    counters::Counter* first_counter() noexcept;
+
+    const std::size_t _shardCount;
+    const std::size_t _length;
+    void* _mapping = nullptr;
+};
@@ -0,0 +1,151 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+// Layout of the shared-memory counters file, in the spirit of Aeron's CnC
+// file: shared by the engine and the ekyc_stat tool, which maps it read-only.
+//
+// A CountersHeader, the engine-wide counters, then one block of ShardCounter
+// counters per shard. Each counter sits on its own cache line and has a
+// single writing thread, so readers never slow the writers down beyond the
+// occasional cache line transfer.
+namespace counters {
+
+constexpr char MAGIC[8] = {'E', 'K', 'Y', 'C', 'C', 'N', 'T', '1'};
+constexpr std::uint32_t VERSION = 4;
+constexpr std::size_t CACHE_LINE = 64;
+
+struct CountersHeader {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t pid;
+    std::uint32_t globalCounterCount;
+    std::uint32_t shardCounterCount;
+    std::uint32_t shardCount;
+    std::uint32_t reserved;
+    std::uint64_t startNs;
+    char padding[24];
+};
+static_assert(sizeof(CountersHeader) == CACHE_LINE,
+              "CountersHeader must stay one cache line");
+
+struct alignas(CACHE_LINE) Counter {
+    std::atomic<std::uint64_t> value;
+};
+static_assert(sizeof(Counter) == CACHE_LINE, "Counter must fill a line");
+static_assert(std::atomic<std::uint64_t>::is_always_lock_free,
+              "Counters are shared between processes");
+
+// Written by the poller thread
+enum GlobalCounter : std::size_t {
+    RECEIVED,
+    DROPPED,
+    GLOBAL_COUNTER_COUNT,
+};
+
+// Written by each shard's worker thread
+enum ShardCounter : std::size_t {
+    VERIFIED,
+    NOT_VERIFIED,
+    ADDED,
+    NOT_ADDED,
+    // Responses whose try_claim was refused by back pressure or an admin
+    // action, once each however often they were retried
+    BACK_PRESSURE,
+    // Extra try_claim attempts while PUBLISH_RETRY_TIMEOUT_US lasted
+    PUBLISH_RETRIES,
+    // Responses parked in the outbound queue, and those lost altogether
+    RESPONSES_QUEUED,
+    RESPONSES_DROPPED,
+    DB_ERRORS,
+    // Bytes waiting in the shard's ring, sampled by the worker
+    QUEUE_DEPTH,
+    // Bytes of responses waiting in the shard's outbound queue
+    OUTBOUND_DEPTH,
+    // Identity cache lookups, and the misses the Bloom filter answered
+    CACHE_HITS,
+    CACHE_MISSES,
+    BLOOM_REJECTED,
+    // Verification batches sent to the DB, by size
+    VERIFY_BATCH_1,
+    VERIFY_BATCH_2_3,
+    VERIFY_BATCH_4_7,
+    VERIFY_BATCH_8_15,
+    VERIFY_BATCH_16_31,
+    VERIFY_BATCH_32_63,
+    VERIFY_BATCH_64_127,
+    VERIFY_BATCH_128_PLUS,
+    SHARD_COUNTER_COUNT,
+};
+
+inline std::size_t file_length(std::size_t shardCount) noexcept {
+    return sizeof(CountersHeader) +
+           (GLOBAL_COUNTER_COUNT + shardCount * SHARD_COUNTER_COUNT) *
+               sizeof(Counter);
+}
+
+inline const char* global_counter_name(std::size_t id) noexcept {
+    switch (id) {
+        case RECEIVED:
+            return "received";
+        case DROPPED:
+            return "dropped";
+        default:
+            return "unknown";
+    }
+}
+
+inline const char* shard_counter_name(std::size_t id) noexcept {
+    switch (id) {
+        case VERIFIED:
+            return "verified";
+        case NOT_VERIFIED:
+            return "not_verified";
+        case ADDED:
+            return "added";
+        case NOT_ADDED:
+            return "not_added";
+        case BACK_PRESSURE:
+            return "back_pressure";
+        case PUBLISH_RETRIES:
+            return "publish_retries";
+        case RESPONSES_QUEUED:
+            return "resp_queued";
+        case RESPONSES_DROPPED:
+            return "resp_dropped";
+        case DB_ERRORS:
+            return "db_errors";
+        case QUEUE_DEPTH:
+            return "queue_depth";
+        case OUTBOUND_DEPTH:
+            return "outbound_depth";
+        case CACHE_HITS:
+            return "cache_hits";
+        case CACHE_MISSES:
+            return "cache_misses";
+        case BLOOM_REJECTED:
+            return "bloom_rejected";
+        case VERIFY_BATCH_1:
+            return "vbatch_1";
+        case VERIFY_BATCH_2_3:
+            return "vbatch_2-3";
+        case VERIFY_BATCH_4_7:
+            return "vbatch_4-7";
+        case VERIFY_BATCH_8_15:
+            return "vbatch_8-15";
+        case VERIFY_BATCH_16_31:
+            return "vbatch_16-31";
+        case VERIFY_BATCH_32_63:
+            return "vbatch_32-63";
+        case VERIFY_BATCH_64_127:
+            return "vbatch_64-127";
+        case VERIFY_BATCH_128_PLUS:
+            return "vbatch_128+";
+        default:
+            return "unknown";
+    }
+}
+
+}  // namespace counters
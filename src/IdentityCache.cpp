@@ -0,0 +1,121 @@
+#include "IdentityCache.h"
+
+#include <cstring>
+#include <new>
+
+namespace {
+
+std::size_t capacity_for(std::size_t expectedSize) noexcept {
+    // Keep the load factor at or below 0.5
+    std::size_t capacity = 16;
+    while (capacity < expectedSize * 2) capacity <<= 1;
+    return capacity;
+}
+
+}  // namespace
+
+IdentityCache::IdentityCache(std::size_t expectedSize)
+    : _mask(0), _hits(0), _misses(0) {
+    rehash(capacity_for(expectedSize));
+}
+
+bool IdentityCache::insert(std::string_view identityNumber,
+                           std::string_view name) noexcept {
+    Key key;
+    if (!make_key(identityNumber, name, key)) return false;
+
+    try {
+        if ((_keys.size() + 1) * 2 > _slots.size()) rehash(_slots.size() * 2);
+
+        const std::uint64_t hash = hash_key(key);
+        const std::size_t index = find_slot(hash, key);
+        if (_slots[index].hash != 0) return true;  // Already present
+
+        // Key first, so a failed push_back leaves no slot pointing past it
+        _keys.push_back(key);
+        _slots[index].hash = hash;
+        _slots[index].keyIndex = static_cast<std::uint32_t>(_keys.size() - 1);
+        return true;
+    } catch (const std::bad_alloc &) {
+        // Only a missed cache hit: the caller's DB answer stays correct
+        return false;
+    }
+}
+
+bool IdentityCache::contains(std::string_view identityNumber,
+                             std::string_view name) noexcept {
+    Key key;
+    if (make_key(identityNumber, name, key)) {
+        const std::uint64_t hash = hash_key(key);
+        if (_slots[find_slot(hash, key)].hash != 0) {
+            ++_hits;
+            return true;
+        }
+    }
+    ++_misses;
+    return false;
+}
+
+void IdentityCache::reserve(std::size_t expectedSize) {
+    _keys.reserve(expectedSize);
+    const std::size_t capacity = capacity_for(expectedSize);
+    if (capacity > _slots.size()) rehash(capacity);
+}
+
+std::size_t IdentityCache::memory_usage() const noexcept {
+    return _slots.capacity() * sizeof(Slot) + _keys.capacity() * sizeof(Key);
+}
+
+bool IdentityCache::make_key(std::string_view identityNumber,
+                             std::string_view name, Key &key) noexcept {
+    if (identityNumber.size() > MAX_ID_LENGTH ||
+        name.size() > MAX_NAME_LENGTH)
+        return false;
+
+    std::memset(&key, 0, sizeof(Key));
+    std::memcpy(key.id, identityNumber.data(), identityNumber.size());
+    std::memcpy(key.name, name.data(), name.size());
+    return true;
+}
+
+// Word-at-a-time multiplicative hash over the zero-padded key
+std::uint64_t IdentityCache::hash_key(const Key &key) noexcept {
+    const char *bytes = reinterpret_cast<const char *>(&key);
+    std::uint64_t hash = 0x9E3779B97F4A7C15ULL;
+    for (std::size_t i = 0; i < sizeof(Key); i += sizeof(std::uint64_t)) {
+        std::uint64_t word;
+        std::memcpy(&word, bytes + i, sizeof(word));
+        hash = (hash ^ word) * 0xFF51AFD7ED558CCDULL;
+        hash ^= hash >> 32;
+    }
+    return hash != 0 ? hash : 1;
+}
+
+// Index of the slot holding key, or of the empty slot where it belongs
+std::size_t IdentityCache::find_slot(std::uint64_t hash,
+                                     const Key &key) const noexcept {
+    std::size_t index = hash & _mask;
+    while (true) {
+        const Slot &slot = _slots[index];
+        if (slot.hash == 0) return index;
+        if (slot.hash == hash &&
+            std::memcmp(&_keys[slot.keyIndex], &key, sizeof(Key)) == 0)
+            return index;
+        index = (index + 1) & _mask;
+    }
+}
+
+void IdentityCache::rehash(std::size_t capacity) {
+    std::vector<Slot> slots(capacity, Slot{0, 0, 0});
+    const std::size_t mask = capacity - 1;
+
+    for (const Slot &slot : _slots) {
+        if (slot.hash == 0) continue;
+        std::size_t index = slot.hash & mask;
+        while (slots[index].hash != 0) index = (index + 1) & mask;
+        slots[index] = slot;
+    }
+
+    _slots.swap(slots);
+    _mask = mask;
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+// In-memory index of known (identity_number, name) pairs.
+//
+// Open addressing with linear probing over 16-byte slots holding the full
+// 64-bit hash, so a probe sequence touches as few cache lines as possible and
+// the fixed-size key in the side arena is only compared on a hash match.
+// Single-threaded: each shard owns one cache for its own partition.
+class IdentityCache final {
+   public:
+    static constexpr std::size_t MAX_ID_LENGTH = 32;
+    static constexpr std::size_t MAX_NAME_LENGTH = 64;
+
+    // Throws std::bad_alloc if the initial table cannot be allocated
+    explicit IdentityCache(std::size_t expectedSize = 1024);
+
+    ~IdentityCache() noexcept = default;
+
+    // Returns false if the key is too long to be cached or the table could
+    // not grow, in which case it is left as it was and lookups of the key
+    // keep missing
+    bool insert(std::string_view identityNumber,
+                std::string_view name) noexcept;
+
+    bool contains(std::string_view identityNumber,
+                  std::string_view name) noexcept;
+
+    // Throws std::bad_alloc, leaving the table as it was
+    void reserve(std::size_t expectedSize);
+
+    std::size_t size() const noexcept { return _keys.size(); }
+
+    std::size_t memory_usage() const noexcept;
+
+    std::uint64_t hits() const noexcept { return _hits; }
+
+    std::uint64_t misses() const noexcept { return _misses; }
+
+   private:
+    struct Key {
+        char id[MAX_ID_LENGTH];
+        char name[MAX_NAME_LENGTH];
+    };
+
+    struct Slot {
+        std::uint64_t hash;  // 0 marks an empty slot
+        std::uint32_t keyIndex;
+        std::uint32_t reserved;
+    };
+    static_assert(sizeof(Slot) == 16, "Slot must stay 16 bytes");
+
+    static bool make_key(std::string_view identityNumber,
+                         std::string_view name, Key &key) noexcept;
+    static std::uint64_t hash_key(const Key &key) noexcept;
+
+    std::size_t find_slot(std::uint64_t hash, const Key &key) const noexcept;
+    // Strong guarantee: throws std::bad_alloc before changing anything
+    void rehash(std::size_t capacity);
+
+    std::vector<Slot> _slots;
+    std::vector<Key> _keys;
+    std::size_t _mask;
+
+    std::uint64_t _hits;
+    std::uint64_t _misses;
+};
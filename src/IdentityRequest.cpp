@@ -0,0 +1,235 @@
+#include "IdentityRequest.h"
+
+#include "helper.h"
+#include "messages/CompactIdentityMessage.h"
+#include "messages/IdentityMessage.h"
+#include "messages/MessageHeader.h"
+#include "messages/VerifyBatchRequest.h"
+
+namespace {
+
+// Whether the sender's block reaches the v2 field at offset. The version
+// alone does not guarantee it, as with carries_timing(); without varData
+// the encoded length is the sender's block length.
+bool block_holds(const messages::IdentityMessage &identity, std::size_t offset,
+                 std::size_t length) noexcept {
+    return identity.encodedLength() >= offset + length;
+}
+
+// v2 clients send the kind as an enum, v1 clients only as the msg string
+messages::MessageKind::Value request_kind(
+    messages::IdentityMessage &identity) noexcept {
+    using messages::IdentityMessage;
+    if (identity.kindInActingVersion() &&
+        block_holds(identity, IdentityMessage::kindEncodingOffset(),
+                    IdentityMessage::kindEncodingLength()))
+        return static_cast<messages::MessageKind::Value>(identity.kindRaw());
+
+    const std::string_view msg = identity.msg().getCharValAsStringView();
+    if (msg == "Identity Verification Request")
+        return messages::MessageKind::VERIFICATION_REQUEST;
+    if (msg == "Add User in System")
+        return messages::MessageKind::ADD_USER_REQUEST;
+    if (msg == "Identity Verification Response")
+        return messages::MessageKind::VERIFICATION_RESPONSE;
+    return messages::MessageKind::NULL_VALUE;
+}
+
+bool request_verified(messages::IdentityMessage &identity) noexcept {
+    using messages::IdentityMessage;
+    if (identity.isVerifiedInActingVersion() &&
+        block_holds(identity, IdentityMessage::isVerifiedEncodingOffset(),
+                    IdentityMessage::isVerifiedEncodingLength()))
+        return identity.isVerifiedRaw() == messages::BooleanType::T;
+    return string_view_to_bool(identity.verified().getCharValAsStringView());
+}
+
+// Spelling stored in the users table
+std::string_view type_name(std::uint8_t type) noexcept {
+    switch (type) {
+        case messages::IdentityType::CNIC:
+            return "cnic";
+        case messages::IdentityType::PASSPORT:
+            return "passport";
+        default:
+            return {};
+    }
+}
+
+// yyyymmdd to "YYYY-MM-DD", empty if unset
+std::string_view format_date(std::uint32_t date, char *text) noexcept {
+    if (date == 0 || date == SBE_NULLVALUE_UINT32) return {};
+
+    const std::uint32_t parts[] = {date / 10000, date / 100 % 100, date % 100};
+    const int widths[] = {4, 2, 2};
+    std::size_t pos = 0;
+    for (int i = 0; i < 3; ++i) {
+        if (i != 0) text[pos++] = '-';
+        std::uint32_t value = parts[i];
+        for (int digit = widths[i] - 1; digit >= 0; --digit) {
+            text[pos + digit] = static_cast<char>('0' + value % 10);
+            value /= 10;
+        }
+        pos += widths[i];
+    }
+    return std::string_view(text, pos);
+}
+
+enum class TimeField { ENGINE_RECEIVE, ENGINE_SEND };
+
+template <typename Message>
+void stamp_message(char *buffer, std::size_t length, TimeField field,
+                   std::uint64_t timeNs) {
+    messages::MessageHeader msgHeader(buffer, length);
+    if (!carries_timing<Message>(msgHeader.version(), msgHeader.blockLength()))
+        return;
+
+    Message message;
+    message.wrapForDecode(buffer, msgHeader.encodedLength(),
+                          msgHeader.blockLength(), msgHeader.version(),
+                          length);
+    if (field == TimeField::ENGINE_RECEIVE)
+        message.engineReceiveTimeNs(timeNs);
+    else
+        message.engineSendTimeNs(timeNs);
+}
+
+// Both identity templates carry the field, batches do not
+void stamp_time(char *buffer, std::size_t length, TimeField field,
+                std::uint64_t timeNs) {
+    messages::MessageHeader msgHeader(buffer, length);
+
+    switch (msgHeader.templateId()) {
+        case messages::IdentityMessage::sbeTemplateId():
+            stamp_message<messages::IdentityMessage>(buffer, length, field,
+                                                     timeNs);
+            break;
+        case messages::CompactIdentityMessage::sbeTemplateId():
+            stamp_message<messages::CompactIdentityMessage>(buffer, length,
+                                                            field, timeNs);
+            break;
+        default:
+            break;
+    }
+}
+
+}  // namespace
+
+bool IdentityRequest::decode(char *start, std::size_t size) {
+    messages::MessageHeader msgHeader;
+    msgHeader.wrap(start, 0, 0, size);
+
+    templateId = msgHeader.templateId();
+    buffer = start;
+    length = size;
+
+    switch (templateId) {
+        case messages::IdentityMessage::sbeTemplateId():
+            decode_identity(start, size);
+            return true;
+        case messages::CompactIdentityMessage::sbeTemplateId():
+            decode_compact(start, size);
+            return true;
+        default:
+            return false;
+    }
+}
+
+void IdentityRequest::decode_identity(char *start, std::size_t size) {
+    messages::MessageHeader msgHeader(start, size);
+    messages::IdentityMessage identity;
+    identity.wrapForDecode(start, msgHeader.encodedLength(),
+                           msgHeader.blockLength(), msgHeader.version(),
+                           size);
+
+    kind = request_kind(identity);
+    verified = request_verified(identity);
+    if (carries_timing<messages::IdentityMessage>(msgHeader.version(),
+                                                  msgHeader.blockLength()))
+        correlationId = identity.correlationId();
+    fields.type = identity.type().getCharValAsStringView();
+    fields.identityNumber = identity.id().getCharValAsStringView();
+    fields.name = identity.name().getCharValAsStringView();
+    fields.dateOfIssue = identity.dateOfIssue().getCharValAsStringView();
+    fields.dateOfExpiry = identity.dateOfExpiry().getCharValAsStringView();
+    fields.address = identity.address().getCharValAsStringView();
+}
+
+void IdentityRequest::decode_compact(char *start, std::size_t size) {
+    messages::MessageHeader msgHeader(start, size);
+    messages::CompactIdentityMessage identity;
+    identity.wrapForDecode(start, msgHeader.encodedLength(),
+                           msgHeader.blockLength(), msgHeader.version(),
+                           size);
+
+    kind = static_cast<messages::MessageKind::Value>(identity.kindRaw());
+    verified = identity.isVerifiedRaw() == messages::BooleanType::T;
+    if (carries_timing<messages::CompactIdentityMessage>(
+            msgHeader.version(), msgHeader.blockLength()))
+        correlationId = identity.correlationId();
+    fields.type = type_name(identity.typeRaw());
+    fields.identityNumber = identity.getIdAsStringView();
+    fields.dateOfIssue = format_date(identity.dateOfIssue(), _dateOfIssue);
+    fields.dateOfExpiry = format_date(identity.dateOfExpiry(), _dateOfExpiry);
+    // varData must be read in schema order
+    fields.name = identity.getNameAsStringView();
+    fields.address = identity.getAddressAsStringView();
+
+    // Only the message itself is echoed, not any trailing bytes
+    length = msgHeader.encodedLength() + identity.encodedLength();
+}
+
+std::string_view routing_key(char *buffer, std::size_t length) {
+    messages::MessageHeader msgHeader(buffer, length);
+
+    switch (msgHeader.templateId()) {
+        case messages::IdentityMessage::sbeTemplateId(): {
+            messages::IdentityMessage identity;
+            identity.wrapForDecode(buffer, msgHeader.encodedLength(),
+                                   msgHeader.blockLength(),
+                                   msgHeader.version(), length);
+            return identity.id().getCharValAsStringView();
+        }
+        case messages::CompactIdentityMessage::sbeTemplateId(): {
+            messages::CompactIdentityMessage identity;
+            identity.wrapForDecode(buffer, msgHeader.encodedLength(),
+                                   msgHeader.blockLength(),
+                                   msgHeader.version(), length);
+            return identity.getIdAsStringView();
+        }
+        case messages::VerifyBatchRequest::sbeTemplateId(): {
+            messages::VerifyBatchRequest batch;
+            batch.wrapForDecode(buffer, msgHeader.encodedLength(),
+                                msgHeader.blockLength(), msgHeader.version(),
+                                length);
+            return std::string_view(
+                batch.buffer() + batch.offset() +
+                    messages::VerifyBatchRequest::batchIdEncodingOffset(),
+                messages::VerifyBatchRequest::batchIdEncodingLength());
+        }
+        default:
+            return {};
+    }
+}
+
+void stamp_receive_time(char *buffer, std::size_t length,
+                        std::uint64_t timeNs) {
+    stamp_time(buffer, length, TimeField::ENGINE_RECEIVE, timeNs);
+}
+
+void stamp_send_time(char *buffer, std::size_t length, std::uint64_t timeNs) {
+    stamp_time(buffer, length, TimeField::ENGINE_SEND, timeNs);
+}
+
+const char *kind_name(messages::MessageKind::Value kind) noexcept {
+    switch (kind) {
+        case messages::MessageKind::VERIFICATION_REQUEST:
+            return "VERIFICATION_REQUEST";
+        case messages::MessageKind::VERIFICATION_RESPONSE:
+            return "VERIFICATION_RESPONSE";
+        case messages::MessageKind::ADD_USER_REQUEST:
+            return "ADD_USER_REQUEST";
+        default:
+            return "UNKNOWN";
+    }
+}
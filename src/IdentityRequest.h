@@ -0,0 +1,94 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include "messages/MessageKind.h"
+
+// Text form of the users columns. The views point into whatever owns the
+// characters: a request fragment, or a RequestBatch entry.
+struct IdentityFields {
+    std::string_view type;
+    std::string_view identityNumber;
+    std::string_view name;
+    std::string_view dateOfIssue;
+    std::string_view dateOfExpiry;
+    std::string_view address;
+};
+
+// An identity request decoded from either IdentityMessage (fixed 64-byte
+// strings) or CompactIdentityMessage (enums, integers and varData), so the
+// rest of the pipeline does not care which template the client speaks.
+//
+// Views point into the decoded fragment, or into the request itself for the
+// compact dates, so it is neither copyable nor valid past the fragment.
+class IdentityRequest final {
+   public:
+    IdentityRequest() noexcept = default;
+
+    IdentityRequest(const IdentityRequest &) noexcept = delete;
+    IdentityRequest &operator=(const IdentityRequest &) noexcept = delete;
+    IdentityRequest(IdentityRequest &&) noexcept = delete;
+    IdentityRequest &operator=(IdentityRequest &&) noexcept = delete;
+
+    // Returns false for an unknown template, throws if the buffer is short
+    bool decode(char *start, std::size_t size);
+
+    std::uint16_t templateId = 0;
+    messages::MessageKind::Value kind = messages::MessageKind::NULL_VALUE;
+    bool verified = false;
+    // Client's key for matching the response, 0 from senders older than
+    // schema version 5
+    std::uint64_t correlationId = 0;
+    // When the engine took the fragment off the subscription, for the journal
+    std::uint64_t receiveTimeNs = 0;
+    IdentityFields fields;
+
+    // The whole SBE message including its header, echoed by the response
+    const char *buffer = nullptr;
+    std::size_t length = 0;
+
+   private:
+    // "YYYY-MM-DD"
+    static constexpr std::size_t DATE_LENGTH = 10;
+
+    void decode_identity(char *start, std::size_t size);
+    void decode_compact(char *start, std::size_t size);
+
+    char _dateOfIssue[DATE_LENGTH];
+    char _dateOfExpiry[DATE_LENGTH];
+};
+
+// Bytes a request is sharded by, without decoding the rest: the identity
+// number of an identity request of either template, so every request for one
+// identity lands on one shard, or the batch id of a VerifyBatchRequest.
+// Empty for unknown templates.
+std::string_view routing_key(char *buffer, std::size_t length);
+
+// Whether a Message block of blockLength bytes written at schema version
+// carries the version 5 correlation and timing fields. The version alone
+// does not guarantee the block is long enough to hold them.
+template <typename Message>
+constexpr bool carries_timing(std::uint64_t version,
+                              std::uint64_t blockLength) noexcept {
+    return version >= Message::correlationIdSinceVersion() &&
+           blockLength >= Message::engineSendTimeNsEncodingOffset() +
+                              Message::engineSendTimeNsEncodingLength();
+}
+
+// Record timeNs in the engineReceiveTimeNs field of an identity request of
+// either template, so the response echoes it however long the request waits
+// in a batch. No-op for senders without the field, throws if the buffer is
+// short.
+void stamp_receive_time(char *buffer, std::size_t length,
+                        std::uint64_t timeNs);
+
+// Record timeNs in the engineSendTimeNs field of an encoded identity
+// response, for one that waited in a queue before it went out. No-op for
+// batch responses and responses without the field, throws if the buffer is
+// short.
+void stamp_send_time(char *buffer, std::size_t length, std::uint64_t timeNs);
+
+// Kind name for logs, never throws
+const char *kind_name(messages::MessageKind::Value kind) noexcept;
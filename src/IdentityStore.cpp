@@ -0,0 +1,20 @@
+#include "IdentityStore.h"
+
+#include <chrono>
+#include <stdexcept>
+
+#include "Config.h"
+#include "InMemoryIdentityStore.h"
+#include "PostgresIdentityStore.h"
+
+std::unique_ptr<IdentityStore> IdentityStore::create(
+    const std::string &backend) {
+    if (backend == "postgresql")
+        return std::make_unique<PostgresIdentityStore>();
+    if (backend == "memory")
+        return std::make_unique<InMemoryIdentityStore>(
+            std::chrono::microseconds(Config::get().DB_MEMORY_LATENCY_US));
+
+    // Not silently PostgreSQL: a typo must not point a test at production
+    throw std::invalid_argument("Unknown DB_BACKEND '" + backend + "'");
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "IdentityRequest.h"
+
+// Where identities are persisted: the statements RequestHandler runs, with
+// the backend behind them chosen by DB_BACKEND. Every call is one round trip
+// and throws on backend errors. One instance per shard, used by its worker
+// thread only.
+class IdentityStore {
+   public:
+    using Column = std::vector<std::string>;
+    using Visitor =
+        std::function<void(std::string_view identityNumber,
+                           std::string_view name)>;
+
+    virtual ~IdentityStore() noexcept = default;
+
+    // Connect to backend ("postgresql" or "memory") with the DB_* settings
+    // from Config. Throws if it is unknown or cannot be reached.
+    static std::unique_ptr<IdentityStore> create(const std::string &backend);
+
+    virtual const char *name() const noexcept = 0;
+
+    // Whether a shard may treat an identity it has neither loaded nor added
+    // as absent, i.e. no other process inserts into the store. Holds for the
+    // life of the store.
+    virtual bool sole_writer() const noexcept = 0;
+
+    // Calls visit for every stored identity, returns how many there were
+    virtual std::size_t for_each_identity(const Visitor &visit) = 0;
+
+    virtual bool exists(std::string_view identityNumber,
+                        std::string_view name) = 0;
+
+    // False if the identity number and name are already stored
+    virtual bool add(const IdentityFields &identity) = 0;
+
+    // Set found[i], zeroed by the caller, for each stored pair of
+    // identityNumbers[i] and names[i]
+    virtual void find_existing(const Column &identityNumbers,
+                               const Column &names, std::uint8_t *found) = 0;
+
+    // Add every row of the columns, setting inserted[i], zeroed by the
+    // caller, for the rows actually added. A row repeated within the batch
+    // is added once and credited to its first occurrence.
+    virtual void add_batch(const Column &types, const Column &identityNumbers,
+                           const Column &names, const Column &datesOfIssue,
+                           const Column &datesOfExpiry,
+                           const Column &addresses,
+                           std::uint8_t *inserted) = 0;
+};
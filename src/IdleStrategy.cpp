@@ -0,0 +1,99 @@
+#include "IdleStrategy.h"
+
+#include <algorithm>
+#include <thread>
+
+#include "Config.h"
+#include "Log.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+namespace {
+
+inline void cpu_relax() noexcept {
+#if defined(__x86_64__) || defined(__i386__)
+    _mm_pause();
+#elif defined(__aarch64__)
+    asm volatile("yield" ::: "memory");
+#endif
+}
+
+}  // namespace
+
+std::unique_ptr<IdleStrategy> IdleStrategy::create(
+    const std::string &name) noexcept {
+    auto &cfg = Config::get();
+
+    if (name == "busy_spin") return std::make_unique<BusySpinIdleStrategy>();
+    if (name == "noop") return std::make_unique<NoOpIdleStrategy>();
+    if (name == "sleeping")
+        return std::make_unique<SleepingIdleStrategy>(
+            std::chrono::nanoseconds(cfg.IDLE_STRATEGY_SLEEP_NS));
+    if (name != "backoff")
+        EKYC_LOG_WARNING("Unknown idle strategy '{}', falling back to backoff",
+                         name);
+
+    return std::make_unique<BackoffIdleStrategy>(
+        cfg.IDLE_STRATEGY_SPINS, cfg.IDLE_STRATEGY_YIELDS,
+        std::chrono::nanoseconds(cfg.IDLE_STRATEGY_MIN_PARK_NS),
+        std::chrono::nanoseconds(cfg.IDLE_STRATEGY_MAX_PARK_NS));
+}
+
+void BusySpinIdleStrategy::idle() noexcept { cpu_relax(); }
+
+void SleepingIdleStrategy::idle() noexcept {
+    std::this_thread::sleep_for(_sleepPeriod);
+}
+
+BackoffIdleStrategy::BackoffIdleStrategy(
+    std::uint64_t maxSpins, std::uint64_t maxYields,
+    std::chrono::nanoseconds minParkPeriod,
+    std::chrono::nanoseconds maxParkPeriod) noexcept
+    : _maxSpins(maxSpins),
+      _maxYields(maxYields),
+      _minParkPeriod(minParkPeriod),
+      _maxParkPeriod(std::max(minParkPeriod, maxParkPeriod)),
+      _state(State::NOT_IDLE),
+      _spins(0),
+      _yields(0),
+      _parkPeriod(minParkPeriod) {}
+
+void BackoffIdleStrategy::idle() noexcept {
+    switch (_state) {
+        case State::NOT_IDLE:
+            _state = State::SPINNING;
+            _spins = 0;
+            [[fallthrough]];
+
+        case State::SPINNING:
+            cpu_relax();
+            if (++_spins > _maxSpins) {
+                _state = State::YIELDING;
+                _yields = 0;
+            }
+            break;
+
+        case State::YIELDING:
+            if (++_yields > _maxYields) {
+                _state = State::PARKING;
+                _parkPeriod = _minParkPeriod;
+            } else {
+                std::this_thread::yield();
+            }
+            break;
+
+        case State::PARKING:
+            std::this_thread::sleep_for(_parkPeriod);
+            _parkPeriod = std::min(_parkPeriod * 2, _maxParkPeriod);
+            break;
+    }
+}
+
+void BackoffIdleStrategy::reset() noexcept {
+    _state = State::NOT_IDLE;
+    _spins = 0;
+    _yields = 0;
+    _parkPeriod = _minParkPeriod;
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+// What a polling or worker loop does when a duty cycle found no work.
+// Loops call idle(workCount) after every cycle; any work resets the backoff.
+class IdleStrategy {
+   public:
+    virtual ~IdleStrategy() noexcept = default;
+
+    void idle(int workCount) noexcept {
+        if (workCount > 0)
+            reset();
+        else
+            idle();
+    }
+
+    virtual void idle() noexcept = 0;
+
+    virtual void reset() noexcept {}
+
+    virtual const char *name() const noexcept = 0;
+
+    // Build a strategy by name ("busy_spin", "backoff", "sleeping", "noop")
+    // using the IDLE_STRATEGY_* tuning from Config
+    static std::unique_ptr<IdleStrategy> create(
+        const std::string &name) noexcept;
+};
+
+// Never gives up the core; lowest latency, for pinned cores only
+class BusySpinIdleStrategy final : public IdleStrategy {
+   public:
+    void idle() noexcept override;
+
+    const char *name() const noexcept override { return "busy_spin"; }
+};
+
+// Returns immediately, the loop spins without even a pause hint
+class NoOpIdleStrategy final : public IdleStrategy {
+   public:
+    void idle() noexcept override {}
+
+    const char *name() const noexcept override { return "noop"; }
+};
+
+// Sleeps a fixed period on every idle cycle
+class SleepingIdleStrategy final : public IdleStrategy {
+   public:
+    explicit SleepingIdleStrategy(std::chrono::nanoseconds sleepPeriod) noexcept
+        : _sleepPeriod(sleepPeriod) {}
+
+    void idle() noexcept override;
+
+    const char *name() const noexcept override { return "sleeping"; }
+
+   private:
+    std::chrono::nanoseconds _sleepPeriod;
+};
+
+// Spins, then yields, then parks with an exponentially growing period capped
+// at maxParkPeriod, so an idle thread releases the CPU while a busy one only
+// ever pays the spin phase.
+class BackoffIdleStrategy final : public IdleStrategy {
+   public:
+    BackoffIdleStrategy(std::uint64_t maxSpins, std::uint64_t maxYields,
+                        std::chrono::nanoseconds minParkPeriod,
+                        std::chrono::nanoseconds maxParkPeriod) noexcept;
+
+    void idle() noexcept override;
+
+    void reset() noexcept override;
+
+    const char *name() const noexcept override { return "backoff"; }
+
+   private:
+    enum class State : std::uint8_t { NOT_IDLE, SPINNING, YIELDING, PARKING };
+
+    const std::uint64_t _maxSpins;
+    const std::uint64_t _maxYields;
+    const std::chrono::nanoseconds _minParkPeriod;
+    const std::chrono::nanoseconds _maxParkPeriod;
+
+    State _state;
+    std::uint64_t _spins;
+    std::uint64_t _yields;
+    std::chrono::nanoseconds _parkPeriod;
+};
@@ -0,0 +1,89 @@
+#include "InMemoryIdentityStore.h"
+
+#include <mutex>
+#include <thread>
+
+InMemoryIdentityStore::InMemoryIdentityStore(
+    std::chrono::nanoseconds latency)
+    : _table(shared_table()), _latency(latency) {}
+
+// Created by the first shard, released with the last
+std::shared_ptr<InMemoryIdentityStore::Table>
+InMemoryIdentityStore::shared_table() {
+    static std::mutex mutex;
+    static std::weak_ptr<Table> table;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto shared = table.lock();
+    if (!shared) {
+        shared = std::make_shared<Table>();
+        table = shared;
+    }
+    return shared;
+}
+
+std::size_t InMemoryIdentityStore::for_each_identity(const Visitor &visit) {
+    round_trip();
+    std::shared_lock<std::shared_mutex> lock(_table->mutex);
+    for (const auto &key : _table->keys) {
+        const std::string_view view(key);
+        const auto separator = view.find('\0');
+        visit(view.substr(0, separator), view.substr(separator + 1));
+    }
+    return _table->keys.size();
+}
+
+bool InMemoryIdentityStore::exists(std::string_view identityNumber,
+                                   std::string_view name) {
+    round_trip();
+    const auto &lookup = key(identityNumber, name);
+    std::shared_lock<std::shared_mutex> lock(_table->mutex);
+    return _table->keys.count(lookup) != 0;
+}
+
+bool InMemoryIdentityStore::add(const IdentityFields &identity) {
+    round_trip();
+    const auto &insert = key(identity.identityNumber, identity.name);
+    std::unique_lock<std::shared_mutex> lock(_table->mutex);
+    return _table->keys.insert(insert).second;
+}
+
+void InMemoryIdentityStore::find_existing(const Column &identityNumbers,
+                                          const Column &names,
+                                          std::uint8_t *found) {
+    round_trip();
+    std::shared_lock<std::shared_mutex> lock(_table->mutex);
+    for (std::size_t i = 0; i < identityNumbers.size(); ++i) {
+        if (_table->keys.count(key(identityNumbers[i], names[i])) != 0)
+            found[i] = 1;
+    }
+}
+
+void InMemoryIdentityStore::add_batch(
+    const Column &types, const Column &identityNumbers, const Column &names,
+    const Column &datesOfIssue, const Column &datesOfExpiry,
+    const Column &addresses, std::uint8_t *inserted) {
+    round_trip();
+    std::unique_lock<std::shared_mutex> lock(_table->mutex);
+    // A repeat within the batch finds its first occurrence already there
+    for (std::size_t i = 0; i < identityNumbers.size(); ++i) {
+        if (_table->keys.insert(key(identityNumbers[i], names[i])).second)
+            inserted[i] = 1;
+    }
+}
+
+const std::string &InMemoryIdentityStore::key(std::string_view identityNumber,
+                                              std::string_view name) {
+    _key.assign(identityNumber.data(), identityNumber.size());
+    _key.push_back('\0');
+    _key.append(name.data(), name.size());
+    return _key;
+}
+
+void InMemoryIdentityStore::round_trip() const noexcept {
+    if (_latency.count() <= 0) return;
+
+    const auto deadline = std::chrono::steady_clock::now() + _latency;
+    while (std::chrono::steady_clock::now() < deadline)
+        std::this_thread::yield();
+}
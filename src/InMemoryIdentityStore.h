@@ -0,0 +1,65 @@
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <unordered_set>
+
+#include "IdentityStore.h"
+
+// A users table in process memory, for measuring the engine without
+// PostgreSQL. All shards share one table, like one database, so batches
+// that span partitions see every shard's adds. It starts empty on every run
+// and only keeps the unique key, identity number and name.
+//
+// Each statement is delayed by latency to stand in for a database round
+// trip. The worker yields until the deadline rather than sleeping, so short
+// delays stay accurate while other threads can still use the core, as they
+// could during a real round trip.
+class InMemoryIdentityStore final : public IdentityStore {
+   public:
+    explicit InMemoryIdentityStore(std::chrono::nanoseconds latency);
+    ~InMemoryIdentityStore() noexcept override = default;
+
+    InMemoryIdentityStore(const InMemoryIdentityStore &) noexcept = delete;
+    InMemoryIdentityStore &operator=(const InMemoryIdentityStore &) noexcept =
+        delete;
+    InMemoryIdentityStore(InMemoryIdentityStore &&) noexcept = delete;
+    InMemoryIdentityStore &operator=(InMemoryIdentityStore &&) noexcept =
+        delete;
+
+    const char *name() const noexcept override { return "memory"; }
+
+    // Only this process sees the table, and adds go to the owning shard
+    bool sole_writer() const noexcept override { return true; }
+
+    std::size_t for_each_identity(const Visitor &visit) override;
+    bool exists(std::string_view identityNumber,
+                std::string_view name) override;
+    bool add(const IdentityFields &identity) override;
+    void find_existing(const Column &identityNumbers, const Column &names,
+                       std::uint8_t *found) override;
+    void add_batch(const Column &types, const Column &identityNumbers,
+                   const Column &names, const Column &datesOfIssue,
+                   const Column &datesOfExpiry, const Column &addresses,
+                   std::uint8_t *inserted) override;
+
+   private:
+    struct Table {
+        std::shared_mutex mutex;
+        // identity number, NUL, name
+        std::unordered_set<std::string> keys;
+    };
+
+    static std::shared_ptr<Table> shared_table();
+
+    // The key in _key, reused so lookups stop allocating once warm
+    const std::string &key(std::string_view identityNumber,
+                           std::string_view name);
+    void round_trip() const noexcept;
+
+    const std::shared_ptr<Table> _table;
+    const std::chrono::nanoseconds _latency;
+    std::string _key;
+};
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// On-disk layout of the request journal, shared by the engine and the
+// journal_decode tool. Little-endian, fixed size, no pointers.
+//
+// A journal file is one JournalHeader followed by JournalRecords. Files are
+// preallocated, so the first record with sequence 0 marks the end of the
+// written part.
+namespace journal {
+
+constexpr char MAGIC[8] = {'E', 'K', 'Y', 'C', 'J', 'N', 'L', '1'};
+constexpr std::uint32_t VERSION = 1;
+
+struct JournalHeader {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t recordSize;
+    std::uint32_t shardId;
+    std::uint32_t reserved;
+    std::uint64_t createdNs;
+    char padding[32];
+};
+static_assert(sizeof(JournalHeader) == 64, "JournalHeader must stay 64 bytes");
+
+enum class Outcome : std::uint8_t {
+    VERIFIED,
+    NOT_VERIFIED,
+    ADDED,
+    NOT_ADDED,
+    ALREADY_VERIFIED,
+    IGNORED,
+};
+
+// Where the answer came from
+enum class Source : std::uint8_t {
+    NONE,
+    CACHE,
+    BLOOM_FILTER,
+    DATABASE,
+};
+
+// Strings are NUL padded and truncated to their field width
+struct JournalRecord {
+    std::uint64_t sequence;  // From 1 per shard, 0 marks unwritten space
+    std::uint64_t receiveTimeNs;
+    std::uint64_t completeTimeNs;
+    std::uint64_t correlationId;  // batchId for batch entries
+    std::uint16_t templateId;
+    std::uint8_t kind;  // messages::MessageKind
+    Outcome outcome;
+    Source source;
+    std::uint8_t reserved[11];
+    char type[16];
+    char identityNumber[32];
+    char name[64];
+    char dateOfIssue[16];
+    char dateOfExpiry[16];
+    char address[64];
+};
+static_assert(sizeof(JournalRecord) == 256,
+              "JournalRecord must stay 256 bytes");
+
+inline const char* outcome_name(Outcome outcome) noexcept {
+    switch (outcome) {
+        case Outcome::VERIFIED:
+            return "VERIFIED";
+        case Outcome::NOT_VERIFIED:
+            return "NOT_VERIFIED";
+        case Outcome::ADDED:
+            return "ADDED";
+        case Outcome::NOT_ADDED:
+            return "NOT_ADDED";
+        case Outcome::ALREADY_VERIFIED:
+            return "ALREADY_VERIFIED";
+        case Outcome::IGNORED:
+            return "IGNORED";
+        default:
+            return "UNKNOWN";
+    }
+}
+
+inline const char* source_name(Source source) noexcept {
+    switch (source) {
+        case Source::NONE:
+            return "NONE";
+        case Source::CACHE:
+            return "CACHE";
+        case Source::BLOOM_FILTER:
+            return "BLOOM_FILTER";
+        case Source::DATABASE:
+            return "DATABASE";
+        default:
+            return "UNKNOWN";
+    }
+}
+
+}  // namespace journal
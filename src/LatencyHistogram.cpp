@@ -0,0 +1,88 @@
+#include "LatencyHistogram.h"
+
+#include <cmath>
+
+namespace {
+
+// Position of the highest set bit, value must be non-zero
+inline unsigned highest_bit(std::uint64_t value) noexcept {
+    return 63 - static_cast<unsigned>(__builtin_clzll(value));
+}
+
+}  // namespace
+
+void LatencyHistogram::add_to(Counts& counts) const noexcept {
+    for (std::size_t i = 0; i < BUCKET_COUNT; ++i)
+        counts[i] += _counts[i].load(std::memory_order_relaxed);
+}
+
+std::size_t LatencyHistogram::bucket_index(std::uint64_t valueNs) noexcept {
+    if (valueNs < LINEAR_LIMIT) return static_cast<std::size_t>(valueNs);
+
+    constexpr std::uint64_t MAX_VALUE =
+        (std::uint64_t{1} << MAX_VALUE_BITS) - 1;
+    if (valueNs > MAX_VALUE) valueNs = MAX_VALUE;
+
+    // Keep the SUB_BUCKET_BITS bits below the highest one
+    const unsigned bit = highest_bit(valueNs);
+    const unsigned shift = bit - SUB_BUCKET_BITS;
+    const std::size_t subBucket =
+        static_cast<std::size_t>(valueNs >> shift) - SUB_BUCKET_COUNT;
+    return LINEAR_LIMIT + (bit - SUB_BUCKET_BITS - 1) * SUB_BUCKET_COUNT +
+           subBucket;
+}
+
+std::uint64_t LatencyHistogram::bucket_value(std::size_t index) noexcept {
+    if (index < LINEAR_LIMIT) return index;
+
+    const std::size_t offset = index - LINEAR_LIMIT;
+    const unsigned shift =
+        static_cast<unsigned>(offset / SUB_BUCKET_COUNT) + 1;
+    const std::uint64_t top = offset % SUB_BUCKET_COUNT + SUB_BUCKET_COUNT;
+    return ((top + 1) << shift) - 1;
+}
+
+std::uint64_t LatencyHistogram::total(const Counts& counts) noexcept {
+    std::uint64_t sum = 0;
+    for (std::uint64_t count : counts) sum += count;
+    return sum;
+}
+
+std::uint64_t LatencyHistogram::percentile(const Counts& counts,
+                                           double percentile) noexcept {
+    const std::uint64_t samples = total(counts);
+    if (samples == 0) return 0;
+
+    // Rank of the sample that covers percentile, at least the first
+    std::uint64_t rank = static_cast<std::uint64_t>(
+        std::ceil(percentile / 100.0 * static_cast<double>(samples)));
+    if (rank == 0) rank = 1;
+
+    std::uint64_t seen = 0;
+    for (std::size_t i = 0; i < BUCKET_COUNT; ++i) {
+        seen += counts[i];
+        if (seen >= rank) return bucket_value(i);
+    }
+    return max(counts);
+}
+
+std::uint64_t LatencyHistogram::max(const Counts& counts) noexcept {
+    for (std::size_t i = BUCKET_COUNT; i > 0; --i)
+        if (counts[i - 1] != 0) return bucket_value(i - 1);
+    return 0;
+}
+
+const char* stage_name(Stage stage) noexcept {
+    switch (stage) {
+        case Stage::DECODE:
+            return "decode";
+        case Stage::LOOKUP:
+            return "lookup";
+        case Stage::ENCODE:
+            return "encode";
+        case Stage::PUBLISH:
+            return "publish";
+        default:
+            return "unknown";
+    }
+}
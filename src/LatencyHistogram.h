@@ -0,0 +1,130 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+// HDR-style latency histogram over nanoseconds: exact below 128 ns, then 64
+// sub-buckets per power of two, so any recorded value is reported within
+// 1/64 (about 1.6%) of its true value. Values above about 18 minutes are
+// clamped into the last bucket.
+//
+// Each histogram has one writing thread; record() is a relaxed load and
+// store, no lock or read-modify-write. Other threads may read the counts
+// concurrently with add_to() and compute percentiles on the merged copy.
+class LatencyHistogram final {
+   public:
+    static constexpr unsigned SUB_BUCKET_BITS = 6;
+    static constexpr std::size_t SUB_BUCKET_COUNT = std::size_t{1}
+                                                    << SUB_BUCKET_BITS;
+    // Values below this each get their own bucket
+    static constexpr std::size_t LINEAR_LIMIT = 2 * SUB_BUCKET_COUNT;
+    static constexpr unsigned MAX_VALUE_BITS = 40;
+    static constexpr std::size_t BUCKET_COUNT =
+        LINEAR_LIMIT +
+        (MAX_VALUE_BITS - SUB_BUCKET_BITS - 1) * SUB_BUCKET_COUNT;
+
+    using Counts = std::array<std::uint64_t, BUCKET_COUNT>;
+
+    LatencyHistogram() noexcept = default;
+    ~LatencyHistogram() noexcept = default;
+
+    LatencyHistogram(const LatencyHistogram&) noexcept = delete;
+    LatencyHistogram& operator=(const LatencyHistogram&) noexcept = delete;
+    LatencyHistogram(LatencyHistogram&&) noexcept = delete;
+    LatencyHistogram& operator=(LatencyHistogram&&) noexcept = delete;
+
+    // Writer thread only
+    void record(std::uint64_t valueNs) noexcept {
+        auto& count = _counts[bucket_index(valueNs)];
+        count.store(count.load(std::memory_order_relaxed) + 1,
+                    std::memory_order_relaxed);
+    }
+
+    // Add the current counts to counts, from any thread
+    void add_to(Counts& counts) const noexcept;
+
+    static std::size_t bucket_index(std::uint64_t valueNs) noexcept;
+    // Highest value that lands in bucket index
+    static std::uint64_t bucket_value(std::size_t index) noexcept;
+
+    static std::uint64_t total(const Counts& counts) noexcept;
+    // Value at or below which percentile (0-100) of the samples fall, 0 for
+    // no samples
+    static std::uint64_t percentile(const Counts& counts,
+                                    double percentile) noexcept;
+    static std::uint64_t max(const Counts& counts) noexcept;
+
+   private:
+    std::array<std::atomic<std::uint64_t>, BUCKET_COUNT> _counts{};
+};
+
+// Stages of a request timed by the shard that handles it
+enum class Stage : std::size_t {
+    // SBE header and message decode
+    DECODE,
+    // Identity cache and bloom filter lookups, and each DB statement
+    LOOKUP,
+    // Response encoding into the claimed publication buffer
+    ENCODE,
+    // Publication try_claim; the commit is a single ordered store
+    PUBLISH,
+    COUNT,
+};
+
+const char* stage_name(Stage stage) noexcept;
+
+// One histogram per Stage, written by a single shard worker
+class StageLatencies final {
+   public:
+    void record(Stage stage, std::uint64_t valueNs) noexcept {
+        _stages[static_cast<std::size_t>(stage)].record(valueNs);
+    }
+
+    const LatencyHistogram& operator[](Stage stage) const noexcept {
+        return _stages[static_cast<std::size_t>(stage)];
+    }
+
+   private:
+    std::array<LatencyHistogram, static_cast<std::size_t>(Stage::COUNT)>
+        _stages;
+};
+
+// Records the time from construction to stop() or destruction into a stage,
+// unless cancel() discards it. Does nothing when latencies is null.
+class StageTimer final {
+   public:
+    StageTimer(StageLatencies* latencies, Stage stage) noexcept
+        : _latencies(latencies),
+          _stage(stage),
+          _start(latencies ? now() : 0) {}
+
+    ~StageTimer() noexcept { stop(); }
+
+    StageTimer(const StageTimer&) noexcept = delete;
+    StageTimer& operator=(const StageTimer&) noexcept = delete;
+    StageTimer(StageTimer&&) noexcept = delete;
+    StageTimer& operator=(StageTimer&&) noexcept = delete;
+
+    void stop() noexcept {
+        if (!_latencies) return;
+        _latencies->record(_stage, now() - _start);
+        _latencies = nullptr;
+    }
+
+    // For a stage that failed, so it does not skew the histogram
+    void cancel() noexcept { _latencies = nullptr; }
+
+   private:
+    static std::uint64_t now() noexcept {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+    }
+
+    StageLatencies* _latencies;
+    Stage _stage;
+    std::uint64_t _start;
+};
@@ -0,0 +1,109 @@
+#include "LatencyReporter.h"
+
+#include <cinttypes>
+#include <cstdio>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <system_error>
+
+#include "Log.h"
+#include "helper.h"
+
+namespace {
+
+std::int64_t ms_between(std::chrono::steady_clock::time_point from,
+                        std::chrono::steady_clock::time_point to) noexcept {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(to - from)
+        .count();
+}
+
+}  // namespace
+
+LatencyReporter::LatencyReporter(std::chrono::milliseconds interval,
+                                 std::string reportFile) noexcept
+    : _interval(interval),
+      _reportFile(std::move(reportFile)),
+      _started(std::chrono::steady_clock::now()),
+      _nextReport(_started + interval),
+      _lastReport(_started) {
+    if (_reportFile.empty()) return;
+
+    std::error_code ec;
+    const auto directory = std::filesystem::path(_reportFile).parent_path();
+    if (!directory.empty()) std::filesystem::create_directories(directory, ec);
+}
+
+void LatencyReporter::add(const StageLatencies* latencies) {
+    _sources.push_back(latencies);
+}
+
+void LatencyReporter::poll() noexcept {
+    if (std::chrono::steady_clock::now() < _nextReport) return;
+    report(false);
+}
+
+void LatencyReporter::report(bool final) noexcept {
+    const auto now = std::chrono::steady_clock::now();
+    const std::int64_t intervalMs = ms_between(_lastReport, now);
+    _lastReport = now;
+    _nextReport = now + _interval;
+
+    for (std::size_t s = 0; s < STAGE_COUNT; ++s) {
+        auto& current = _current[s];
+        auto& previous = _previous[s];
+        current.fill(0);
+        for (const auto* source : _sources)
+            (*source)[static_cast<Stage>(s)].add_to(current);
+
+        // current becomes the interval's counts, previous the running total
+        for (std::size_t i = 0; i < current.size(); ++i) {
+            const std::uint64_t cumulative = current[i];
+            current[i] -= previous[i];
+            previous[i] = cumulative;
+        }
+    }
+
+    auto format = [](const char* scope, std::int64_t ms, Stage stage,
+                     const LatencyHistogram::Counts& counts) {
+        char line[256];
+        std::snprintf(
+            line, sizeof(line),
+            "latency %s %s over %" PRId64 " ms: count=%" PRIu64
+            " p50=%" PRIu64 "ns p99=%" PRIu64 "ns p99.9=%" PRIu64
+            "ns max=%" PRIu64 "ns",
+            scope, stage_name(stage), ms, LatencyHistogram::total(counts),
+            LatencyHistogram::percentile(counts, 50.0),
+            LatencyHistogram::percentile(counts, 99.0),
+            LatencyHistogram::percentile(counts, 99.9),
+            LatencyHistogram::max(counts));
+        return std::string(line);
+    };
+
+    for (std::size_t s = 0; s < STAGE_COUNT; ++s) {
+        if (LatencyHistogram::total(_current[s]) == 0) continue;
+        write(format("interval", intervalMs, static_cast<Stage>(s),
+                     _current[s]));
+    }
+    if (!final) return;
+
+    const std::int64_t totalMs = ms_between(_started, now);
+    for (std::size_t s = 0; s < STAGE_COUNT; ++s) {
+        if (LatencyHistogram::total(_previous[s]) == 0) continue;
+        write(format("total", totalMs, static_cast<Stage>(s), _previous[s]));
+    }
+}
+
+void LatencyReporter::write(const std::string& line) noexcept {
+    EKYC_LOG_INFO("{}", line);
+    if (_reportFile.empty()) return;
+
+    try {
+        std::ofstream out(_reportFile, std::ios::app);
+        out << epoch_nanos() << ' ' << line << '\n';
+        if (!out)
+            EKYC_LOG_ERROR("Error writing latency report to {}", _reportFile);
+    } catch (const std::exception& e) {
+        EKYC_LOG_ERROR("Error writing latency report: {}", e.what());
+    }
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "LatencyHistogram.h"
+
+// Periodically merges the StageLatencies of every shard and reports
+// p50/p99/p99.9/max per stage, for the interval since the previous report,
+// to the log and optionally appended to a file.
+//
+// Runs on a thread that is not on the request path; shard workers keep
+// recording meanwhile.
+class LatencyReporter final {
+   public:
+    LatencyReporter(std::chrono::milliseconds interval,
+                    std::string reportFile) noexcept;
+    ~LatencyReporter() noexcept = default;
+
+    LatencyReporter(const LatencyReporter&) noexcept = delete;
+    LatencyReporter& operator=(const LatencyReporter&) noexcept = delete;
+    LatencyReporter(LatencyReporter&&) noexcept = delete;
+    LatencyReporter& operator=(LatencyReporter&&) noexcept = delete;
+
+    // Must outlive the reporter
+    void add(const StageLatencies* latencies);
+
+    // Report if the interval has elapsed
+    void poll() noexcept;
+
+    // Report the interval so far, and totals since start when final
+    void report(bool final) noexcept;
+
+   private:
+    static constexpr std::size_t STAGE_COUNT =
+        static_cast<std::size_t>(Stage::COUNT);
+
+    void write(const std::string& line) noexcept;
+
+    const std::chrono::milliseconds _interval;
+    const std::string _reportFile;
+    const std::chrono::steady_clock::time_point _started;
+    std::chrono::steady_clock::time_point _nextReport;
+    std::chrono::steady_clock::time_point _lastReport;
+
+    std::vector<const StageLatencies*> _sources;
+    // Merged counts as of the previous report, and scratch for the current
+    std::array<LatencyHistogram::Counts, STAGE_COUNT> _previous{};
+    std::array<LatencyHistogram::Counts, STAGE_COUNT> _current{};
+};
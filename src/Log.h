@@ -0,0 +1,91 @@
+#pragma once
+
+#include <atomic>
+#include <string_view>
+
+#include "loggerlib.h"
+
+// Leveled logging that costs nothing when a level is off.
+//
+// EKYC_MIN_LOG_LEVEL, set by the EKYC_LOG_LEVEL CMake option, removes every
+// statement below it at compile time. Statements that are compiled in check
+// the runtime level (LOG_LEVEL in config.txt) before their arguments are
+// evaluated, so a disabled line never formats, copies or allocates.
+//
+// loggerlib only has an info and an error sink. Warnings go to the error
+// sink, tagged so they can be told apart and filtered out of error alerts;
+// the format must therefore be a string literal.
+//
+//     EKYC_LOG_DEBUG("Shard {} resolved batch of {}", shardId, count);
+
+#define EKYC_LOG_LEVEL_DEBUG 0
+#define EKYC_LOG_LEVEL_INFO 1
+#define EKYC_LOG_LEVEL_WARNING 2
+#define EKYC_LOG_LEVEL_ERROR 3
+
+#ifndef EKYC_MIN_LOG_LEVEL
+#define EKYC_MIN_LOG_LEVEL EKYC_LOG_LEVEL_DEBUG
+#endif
+
+namespace logging {
+
+inline std::atomic<int> runtimeLevel{EKYC_LOG_LEVEL_DEBUG};
+
+inline bool enabled(int level) noexcept {
+    return level >= runtimeLevel.load(std::memory_order_relaxed);
+}
+
+inline void set_level(int level) noexcept {
+    runtimeLevel.store(level, std::memory_order_relaxed);
+}
+
+// DEBUG | INFO | WARNING | ERROR, anything else is DEBUG
+inline int parse_level(std::string_view name) noexcept {
+    if (name == "INFO") return EKYC_LOG_LEVEL_INFO;
+    if (name == "WARNING") return EKYC_LOG_LEVEL_WARNING;
+    if (name == "ERROR") return EKYC_LOG_LEVEL_ERROR;
+    return EKYC_LOG_LEVEL_DEBUG;
+}
+
+}  // namespace logging
+
+#define EKYC_LOG_AT(level, method, ...)         \
+    do {                                        \
+        if (::logging::enabled(level))          \
+            qLogger::get().method(__VA_ARGS__); \
+    } while (0)
+
+// Still type-checked, never evaluated
+#define EKYC_LOG_OFF(method, ...)                      \
+    do {                                               \
+        if (false) qLogger::get().method(__VA_ARGS__); \
+    } while (0)
+
+#if EKYC_MIN_LOG_LEVEL <= EKYC_LOG_LEVEL_DEBUG
+#define EKYC_LOG_DEBUG(...) \
+    EKYC_LOG_AT(EKYC_LOG_LEVEL_DEBUG, info_fast, __VA_ARGS__)
+#else
+#define EKYC_LOG_DEBUG(...) EKYC_LOG_OFF(info_fast, __VA_ARGS__)
+#endif
+
+#if EKYC_MIN_LOG_LEVEL <= EKYC_LOG_LEVEL_INFO
+#define EKYC_LOG_INFO(...) \
+    EKYC_LOG_AT(EKYC_LOG_LEVEL_INFO, info_fast, __VA_ARGS__)
+#else
+#define EKYC_LOG_INFO(...) EKYC_LOG_OFF(info_fast, __VA_ARGS__)
+#endif
+
+#if EKYC_MIN_LOG_LEVEL <= EKYC_LOG_LEVEL_WARNING
+#define EKYC_LOG_WARNING(...)                                  \
+    EKYC_LOG_AT(EKYC_LOG_LEVEL_WARNING, error_fast, "[WARNING] " \
+                __VA_ARGS__)
+#else
+#define EKYC_LOG_WARNING(...) EKYC_LOG_OFF(error_fast, "[WARNING] " __VA_ARGS__)
+#endif
+
+#if EKYC_MIN_LOG_LEVEL <= EKYC_LOG_LEVEL_ERROR
+#define EKYC_LOG_ERROR(...) \
+    EKYC_LOG_AT(EKYC_LOG_LEVEL_ERROR, error_fast, __VA_ARGS__)
+#else
+#define EKYC_LOG_ERROR(...) EKYC_LOG_OFF(error_fast, __VA_ARGS__)
+#endif
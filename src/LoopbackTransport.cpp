@@ -0,0 +1,50 @@
+#include "LoopbackTransport.h"
+
+#include <stdexcept>
+
+namespace {
+
+// Claims straight from one shard's response ring, so responses are encoded
+// in place just like into an Aeron term buffer
+class LoopbackPublisher final : public ResponsePublisher {
+   public:
+    explicit LoopbackPublisher(SPSCRingBuffer *ring) noexcept : _ring(ring) {}
+
+    SendResult try_claim(std::size_t length, char *&buffer) override {
+        char *claimed = _ring->try_claim(length);
+        if (!claimed) return SendResult::BACK_PRESSURED;
+        buffer = claimed;
+        return SendResult::SUCCESS;
+    }
+
+    void commit() noexcept override { _ring->commit(); }
+
+    // Never committed, so the next claim reuses the space
+    void abort() noexcept override {}
+
+   private:
+    SPSCRingBuffer *_ring;
+};
+
+}  // namespace
+
+LoopbackTransport::LoopbackTransport(std::size_t ringSize,
+                                     std::uint32_t shardCount)
+    : _requests(ringSize) {
+    _responses.reserve(shardCount);
+    for (std::uint32_t i = 0; i < shardCount; ++i)
+        _responses.push_back(std::make_unique<SPSCRingBuffer>(ringSize));
+}
+
+int LoopbackTransport::poll(const FragmentHandler &handler,
+                            int fragmentLimit) {
+    return static_cast<int>(
+        _requests.read(handler, static_cast<std::size_t>(fragmentLimit)));
+}
+
+std::unique_ptr<ResponsePublisher> LoopbackTransport::publisher(
+    std::uint32_t shardId) {
+    if (shardId >= _responses.size())
+        throw std::out_of_range("No loopback response ring for shard");
+    return std::make_unique<LoopbackPublisher>(_responses[shardId].get());
+}
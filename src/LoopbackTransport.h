@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "SPSCRingBuffer.h"
+#include "Transport.h"
+
+// Both directions as SPSC rings in process memory, for benchmarks that drive
+// the whole engine without a media driver or the kernel: a driver thread
+// offers requests that the engine's poller reads, and each shard commits
+// responses to its own ring that the driver drains with poll_responses().
+class LoopbackTransport final : public Transport {
+   public:
+    // Rings of ringSize bytes, one for requests and one per shard
+    LoopbackTransport(std::size_t ringSize, std::uint32_t shardCount);
+    ~LoopbackTransport() noexcept override = default;
+
+    LoopbackTransport(const LoopbackTransport &) noexcept = delete;
+    LoopbackTransport &operator=(const LoopbackTransport &) noexcept = delete;
+    LoopbackTransport(LoopbackTransport &&) noexcept = delete;
+    LoopbackTransport &operator=(LoopbackTransport &&) noexcept = delete;
+
+    const char *name() const noexcept override { return "loopback"; }
+
+    int poll(const FragmentHandler &handler, int fragmentLimit) override;
+
+    // Throws if shardId is not below shardCount
+    std::unique_ptr<ResponsePublisher> publisher(
+        std::uint32_t shardId) override;
+
+    // Driver side, from one thread: queue a request for the engine, false if
+    // the ring is full
+    bool offer(const char *buffer, std::size_t length) noexcept {
+        return _requests.try_write(buffer, length);
+    }
+
+    // Driver side, from one thread: invoke handler(char *, std::size_t) for
+    // up to limit responses of each shard
+    template <typename Handler>
+    std::size_t poll_responses(Handler &&handler, std::size_t limit) noexcept {
+        std::size_t count = 0;
+        for (auto &ring : _responses) count += ring->read(handler, limit);
+        return count;
+    }
+
+   private:
+    SPSCRingBuffer _requests;
+    std::vector<std::unique_ptr<SPSCRingBuffer>> _responses;
+};
@@ -1,6 +1,6 @@
 #include "Message.h"
 
-#include "loggerlib.h"
+#include "Log.h"
 
 Message::Message(MessageType mType, int mId) noexcept
     : msgType(mType), msgId(mId) {}
@@ -13,10 +13,10 @@ OrderMessage::OrderMessage(int msgId, std::string sym, int qty,
       price(prc) {}
 
 StepResult OrderMessage::validate() const noexcept {
-    qLogger::get().info_fast("Order {} Validate symbol={}", msgId, symbol);
+    EKYC_LOG_DEBUG("Order {} Validate symbol={}", msgId, symbol);
 
     if (quantity <= 0 || price <= 0.0) {
-        qLogger::get().error_fast("Order {} Invalid quantity/price", msgId);
+        EKYC_LOG_ERROR("Order {} Invalid quantity/price", msgId);
         return StepResult::FAILED;
     }
     return StepResult::SUCCESS;
@@ -26,11 +26,10 @@ CancelMessage::CancelMessage(int msgId, int cId) noexcept
     : Message(MT_CANCEL, msgId), cancelId(cId) {}
 
 StepResult CancelMessage::validate() const noexcept {
-    qLogger::get().info_fast("Cancel {} Validate cancelId= {}", msgId,
-                             cancelId);
+    EKYC_LOG_DEBUG("Cancel {} Validate cancelId= {}", msgId, cancelId);
 
     if (cancelId <= 0) {
-        qLogger::get().error_fast("Cancel {} Invalid cancelId", msgId);
+        EKYC_LOG_ERROR("Cancel {} Invalid cancelId", msgId);
         return StepResult::FAILED;
     }
     return StepResult::SUCCESS;
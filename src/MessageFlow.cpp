@@ -1,6 +1,6 @@
 #include "MessageFlow.h"
 
-#include "loggerlib.h"
+#include "Log.h"
 
 // Static member definition
 std::unordered_map<MessageType, std::vector<MessageFlow::Step>>
@@ -39,7 +39,7 @@ void MessageFlow::execute(const Message& msg) noexcept {
     auto itr = _registry.find(msg.msgType);
 
     if (itr == _registry.end()) {
-        qLogger::get().error_fast(
+        EKYC_LOG_ERROR(
             "No flow registered for message type {} and message id {}",
             msgtype_to_string(msg.msgType), msg.msgId);
         return;
@@ -48,13 +48,12 @@ void MessageFlow::execute(const Message& msg) noexcept {
     for (auto& step : itr->second) {
         StepResult res = step(msg);
         if (res == StepResult::FAILED) {
-            qLogger::get().error_fast("Flow Msg {} {} stopped due to failure",
-                                      msgtype_to_string(msg.msgType),
-                                      msg.msgId);
+            EKYC_LOG_ERROR("Flow Msg {} {} stopped due to failure",
+                           msgtype_to_string(msg.msgType), msg.msgId);
             return;
         }
     }
 
-    qLogger::get().info_fast("Flow Msg {} {} completed successfully",
-                             msgtype_to_string(msg.msgType), msg.msgId);
+    EKYC_LOG_DEBUG("Flow Msg {} {} completed successfully",
+                   msgtype_to_string(msg.msgType), msg.msgId);
 }
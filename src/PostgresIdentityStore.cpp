@@ -0,0 +1,152 @@
+#include "PostgresIdentityStore.h"
+
+#include <stdexcept>
+#include <string>
+
+#include "Config.h"
+#include "DatabaseFactory.h"
+#include "Log.h"
+#include "PostgreDatabase.h"
+
+namespace {
+
+// Prepared once per connection, executed by name on the hot path
+constexpr const char *EXIST_USER_STMT = "exist_user";
+constexpr const char *EXIST_USER_SQL =
+    "SELECT 1 FROM users WHERE identity_number = $1 AND name = $2 LIMIT 1";
+
+// Returns a row only if it was inserted, duplicates are rejected atomically
+// by the unique index below
+constexpr const char *ADD_IDENTITY_STMT = "add_identity";
+constexpr const char *ADD_IDENTITY_SQL =
+    "INSERT INTO users (type, identity_number, name, date_of_issue, "
+    "date_of_expiry, address) VALUES ($1, $2, $3, $4, $5, $6) "
+    "ON CONFLICT (identity_number, name) DO NOTHING RETURNING id";
+
+// Inserts a whole batch, returning the rows actually inserted
+constexpr const char *ADD_BATCH_STMT = "add_batch";
+constexpr const char *ADD_BATCH_SQL =
+    "INSERT INTO users (type, identity_number, name, date_of_issue, "
+    "date_of_expiry, address) SELECT * FROM unnest($1::text[], $2::text[], "
+    "$3::text[], $4::date[], $5::date[], $6::text[]) "
+    "ON CONFLICT (identity_number, name) DO NOTHING "
+    "RETURNING identity_number, name";
+
+// Resolves a whole batch, returning the 1-based positions that exist
+constexpr const char *VERIFY_BATCH_STMT = "verify_batch";
+constexpr const char *VERIFY_BATCH_SQL =
+    "SELECT q.idx FROM unnest($1::text[], $2::text[]) WITH ORDINALITY "
+    "AS q(identity_number, name, idx) WHERE EXISTS (SELECT 1 FROM users u "
+    "WHERE u.identity_number = q.identity_number AND u.name = q.name)";
+
+constexpr const char *LOAD_IDENTITIES_SQL =
+    "SELECT identity_number, name FROM users";
+
+// Fails if the table already holds duplicates, which must be cleaned first
+constexpr const char *UNIQUE_IDENTITY_SQL =
+    "CREATE UNIQUE INDEX IF NOT EXISTS users_identity_number_name_key "
+    "ON users (identity_number, name)";
+
+PostgreResult *postgres_result(const std::unique_ptr<IResult> &res) {
+    if (!res) throw std::runtime_error("DB exec returned null");
+    auto pgResult = dynamic_cast<PostgreResult *>(res.get());
+    if (!pgResult) throw std::runtime_error("Unexpected DB result type");
+    return pgResult;
+}
+
+}  // namespace
+
+PostgresIdentityStore::PostgresIdentityStore() {
+    auto &cfg = Config::get();
+    auto pgConfig = DatabaseConfig(cfg.DB_HOST, cfg.DB_PORT, cfg.DB_NAME,
+                                   cfg.DB_USER, cfg.DB_PASSWORD);
+
+    auto pgDb = DatabaseFactory::create("postgresql", pgConfig);
+    _db = dynamic_cast<PostgreDatabase *>(pgDb.get());
+    _dbManager = std::make_unique<DatabaseManager>(std::move(pgDb));
+    if (!_db) throw std::runtime_error("Unexpected DB backend type");
+
+    EKYC_LOG_INFO("Connected to PostGreSQL");
+
+    prepare_statements();
+}
+
+void PostgresIdentityStore::prepare_statements() {
+    // ON CONFLICT in add_identity needs the unique index to exist
+    _db->exec(UNIQUE_IDENTITY_SQL);
+
+    _db->prepare(EXIST_USER_STMT, EXIST_USER_SQL);
+    _db->prepare(ADD_IDENTITY_STMT, ADD_IDENTITY_SQL);
+    _db->prepare(VERIFY_BATCH_STMT, VERIFY_BATCH_SQL);
+    _db->prepare(ADD_BATCH_STMT, ADD_BATCH_SQL);
+
+    EKYC_LOG_INFO("Prepared identity statements");
+}
+
+bool PostgresIdentityStore::sole_writer() const noexcept {
+    return Config::get().DB_SINGLE_WRITER;
+}
+
+std::size_t PostgresIdentityStore::for_each_identity(const Visitor &visit) {
+    auto res = _db->exec(LOAD_IDENTITIES_SQL);
+    auto pgResult = postgres_result(res);
+
+    const std::size_t rows = pgResult->size();
+    for (std::size_t row = 0; row < rows; ++row)
+        visit(pgResult->get_value(row, 0), pgResult->get_value(row, 1));
+    return rows;
+}
+
+bool PostgresIdentityStore::exists(std::string_view identityNumber,
+                                   std::string_view name) {
+    auto res = _db->exec_prepared(EXIST_USER_STMT, identityNumber, name);
+    return !postgres_result(res)->empty();
+}
+
+bool PostgresIdentityStore::add(const IdentityFields &identity) {
+    // Insert user into database, a single round trip
+    auto res = _db->exec_prepared(
+        ADD_IDENTITY_STMT, identity.type, identity.identityNumber,
+        identity.name, identity.dateOfIssue, identity.dateOfExpiry,
+        identity.address);
+    // Empty if the user already exists, don't add duplicate
+    return !postgres_result(res)->empty();
+}
+
+void PostgresIdentityStore::find_existing(const Column &identityNumbers,
+                                          const Column &names,
+                                          std::uint8_t *found) {
+    auto res = _db->exec_prepared(VERIFY_BATCH_STMT, identityNumbers, names);
+    auto pgResult = postgres_result(res);
+
+    const std::size_t count = identityNumbers.size();
+    for (std::size_t row = 0; row < pgResult->size(); ++row) {
+        const std::size_t index = std::stoull(pgResult->get_value(row, 0)) - 1;
+        if (index < count) found[index] = 1;
+    }
+}
+
+void PostgresIdentityStore::add_batch(
+    const Column &types, const Column &identityNumbers, const Column &names,
+    const Column &datesOfIssue, const Column &datesOfExpiry,
+    const Column &addresses, std::uint8_t *inserted) {
+    auto res =
+        _db->exec_prepared(ADD_BATCH_STMT, types, identityNumbers, names,
+                           datesOfIssue, datesOfExpiry, addresses);
+    auto pgResult = postgres_result(res);
+
+    // Rows come back in no particular order; a duplicate within the batch
+    // is inserted once, so credit its first occurrence
+    const std::size_t count = identityNumbers.size();
+    for (std::size_t row = 0; row < pgResult->size(); ++row) {
+        const std::string identityNumber = pgResult->get_value(row, 0);
+        const std::string name = pgResult->get_value(row, 1);
+        for (std::size_t i = 0; i < count; ++i) {
+            if (inserted[i] == 0 && identityNumbers[i] == identityNumber &&
+                names[i] == name) {
+                inserted[i] = 1;
+                break;
+            }
+        }
+    }
+}
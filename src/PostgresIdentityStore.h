@@ -0,0 +1,48 @@
+#pragma once
+
+#include <memory>
+
+#include "DatabaseManager.h"
+#include "IdentityStore.h"
+
+// Forward declaration
+class PostgreDatabase;
+
+// The users table, one connection per shard with the statements prepared
+// once on it
+class PostgresIdentityStore final : public IdentityStore {
+   public:
+    // Connects and prepares the statements, throws on failure
+    PostgresIdentityStore();
+    ~PostgresIdentityStore() noexcept override = default;
+
+    PostgresIdentityStore(const PostgresIdentityStore &) noexcept = delete;
+    PostgresIdentityStore &operator=(const PostgresIdentityStore &) noexcept =
+        delete;
+    PostgresIdentityStore(PostgresIdentityStore &&) noexcept = delete;
+    PostgresIdentityStore &operator=(PostgresIdentityStore &&) noexcept =
+        delete;
+
+    const char *name() const noexcept override { return "postgresql"; }
+
+    // DB_SINGLE_WRITER, the operator's word: other writers of the table
+    // cannot be detected from here
+    bool sole_writer() const noexcept override;
+    std::size_t for_each_identity(const Visitor &visit) override;
+    bool exists(std::string_view identityNumber,
+                std::string_view name) override;
+    bool add(const IdentityFields &identity) override;
+    void find_existing(const Column &identityNumbers, const Column &names,
+                       std::uint8_t *found) override;
+    void add_batch(const Column &types, const Column &identityNumbers,
+                   const Column &names, const Column &datesOfIssue,
+                   const Column &datesOfExpiry, const Column &addresses,
+                   std::uint8_t *inserted) override;
+
+   private:
+    void prepare_statements();
+
+    std::unique_ptr<DatabaseManager> _dbManager;
+    // Owned by _dbManager, kept for the PostgreSQL-only statement API
+    PostgreDatabase *_db = nullptr;
+};
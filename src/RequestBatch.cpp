@@ -0,0 +1,119 @@
+#include "RequestBatch.h"
+
+#include <algorithm>
+
+#include "AllocationCheck.h"
+#include "helper.h"
+#include "messages/IdentityMessage.h"
+#include "messages/MessageHeader.h"
+
+namespace {
+
+// The larger of the two request templates, with its fixed 64-byte strings
+constexpr std::size_t RESERVED_REQUEST_LENGTH =
+    messages::MessageHeader::encodedLength() +
+    messages::IdentityMessage::sbeBlockLength();
+constexpr std::size_t RESERVED_FIELD_LENGTH = 64;
+
+std::size_t slots_for(std::size_t capacity) noexcept {
+    std::size_t slots = 16;
+    while (slots < capacity * 2) slots *= 2;
+    return slots;
+}
+
+bool fits(const RequestBatch::Entry &entry,
+          const IdentityRequest &request) noexcept {
+    const IdentityFields &fields = request.fields;
+    return request.length <= entry.request.capacity() &&
+           fields.type.size() <= entry.type.capacity() &&
+           fields.identityNumber.size() <= entry.identityNumber.capacity() &&
+           fields.name.size() <= entry.name.capacity() &&
+           fields.dateOfIssue.size() <= entry.dateOfIssue.capacity() &&
+           fields.dateOfExpiry.size() <= entry.dateOfExpiry.capacity() &&
+           fields.address.size() <= entry.address.capacity();
+}
+
+}  // namespace
+
+IdentityFields RequestBatch::Entry::fields() const noexcept {
+    return {type, identityNumber, name, dateOfIssue, dateOfExpiry, address};
+}
+
+RequestBatch::RequestBatch(std::size_t capacity,
+                           std::chrono::milliseconds maxWait)
+    : _entries(std::max<std::size_t>(capacity, 1)),
+      _slots(slots_for(_entries.size()), Slot{0, 0, 0}),
+      _mask(_slots.size() - 1),
+      _size(0),
+      _maxWait(maxWait) {
+    for (auto &entry : _entries) {
+        entry.request.reserve(RESERVED_REQUEST_LENGTH);
+        entry.type.reserve(RESERVED_FIELD_LENGTH);
+        entry.identityNumber.reserve(RESERVED_FIELD_LENGTH);
+        entry.name.reserve(RESERVED_FIELD_LENGTH);
+        entry.dateOfIssue.reserve(RESERVED_FIELD_LENGTH);
+        entry.dateOfExpiry.reserve(RESERVED_FIELD_LENGTH);
+        entry.address.reserve(RESERVED_FIELD_LENGTH);
+    }
+}
+
+void RequestBatch::push(const IdentityRequest &request) {
+    if (_size == 0) _deadline = std::chrono::steady_clock::now() + _maxWait;
+
+    auto &entry = _entries[_size];
+    // e.g. a compact request with a name longer than 64 bytes; the entry
+    // keeps the larger capacity from then on
+    if (!fits(entry, request)) AllocationCheck::allow();
+    entry.request.assign(request.buffer, request.buffer + request.length);
+    entry.type = request.fields.type;
+    entry.identityNumber = request.fields.identityNumber;
+    entry.name = request.fields.name;
+    entry.dateOfIssue = request.fields.dateOfIssue;
+    entry.dateOfExpiry = request.fields.dateOfExpiry;
+    entry.address = request.fields.address;
+    entry.receiveTimeNs = request.receiveTimeNs;
+
+    // A repeated identity number keeps its first entry's slot
+    const std::uint64_t hash = hash_id(entry.identityNumber);
+    Slot &slot = _slots[find_slot(hash, entry.identityNumber)];
+    if (slot.hash == 0) {
+        slot.hash = hash;
+        slot.entryIndex = static_cast<std::uint32_t>(_size);
+    }
+    ++_size;
+}
+
+bool RequestBatch::contains(std::string_view identityNumber) const noexcept {
+    if (_size == 0) return false;
+
+    const std::uint64_t hash = hash_id(identityNumber);
+    return _slots[find_slot(hash, identityNumber)].hash != 0;
+}
+
+void RequestBatch::clear() noexcept {
+    if (_size == 0) return;
+
+    ++_histogram[bucket_of(_size)];
+
+    std::fill(_slots.begin(), _slots.end(), Slot{0, 0, 0});
+    _size = 0;
+}
+
+std::uint64_t RequestBatch::hash_id(std::string_view identityNumber) noexcept {
+    const std::uint64_t hash =
+        hash_bytes(identityNumber.data(), identityNumber.size());
+    return hash != 0 ? hash : 1;
+}
+
+std::size_t RequestBatch::find_slot(
+    std::uint64_t hash, std::string_view identityNumber) const noexcept {
+    std::size_t index = hash & _mask;
+    while (true) {
+        const Slot &slot = _slots[index];
+        if (slot.hash == 0) return index;
+        if (slot.hash == hash &&
+            _entries[slot.entryIndex].identityNumber == identityNumber)
+            return index;
+        index = (index + 1) & _mask;
+    }
+}
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "IdentityRequest.h"
+
+// Requests waiting to be resolved together by one DB statement. The batch is
+// due once it is full or its oldest entry has waited maxWait. Entries keep a
+// copy of the SBE request and its fields so the response can echo it after
+// the fragment is gone; their storage is reserved for a full IdentityMessage
+// up front and reused from batch to batch, so push() does not allocate for
+// requests that fit. An open-addressing set over the pending identity
+// numbers, cleared with the batch, keeps contains() to a probe or two.
+class RequestBatch final {
+   public:
+    struct Entry {
+        std::vector<char> request;
+        std::string type;
+        std::string identityNumber;
+        std::string name;
+        std::string dateOfIssue;
+        std::string dateOfExpiry;
+        std::string address;
+        std::uint64_t receiveTimeNs = 0;
+
+        // Views over the strings above
+        IdentityFields fields() const noexcept;
+    };
+
+    // Batches by size: 1, 2-3, 4-7, ..., 128+
+    using Histogram = std::array<std::uint64_t, 8>;
+
+    RequestBatch(std::size_t capacity, std::chrono::milliseconds maxWait);
+
+    ~RequestBatch() noexcept = default;
+
+    // Throws if a request larger than the reserve cannot be copied
+    void push(const IdentityRequest &request);
+
+    // Whether a pending entry has this identity number
+    bool contains(std::string_view identityNumber) const noexcept;
+
+    bool full() const noexcept { return _size == _entries.size(); }
+
+    bool empty() const noexcept { return _size == 0; }
+
+    bool due() const noexcept {
+        if (_size == 0) return false;
+        return full() || std::chrono::steady_clock::now() >= _deadline;
+    }
+
+    std::size_t size() const noexcept { return _size; }
+
+    std::size_t capacity() const noexcept { return _entries.size(); }
+
+    Entry &operator[](std::size_t index) noexcept { return _entries[index]; }
+
+    // Forget all entries once they have been answered
+    void clear() noexcept;
+
+    const Histogram &histogram() const noexcept { return _histogram; }
+
+    // Histogram index of a batch of size entries
+    static std::size_t bucket_of(std::size_t size) noexcept {
+        std::size_t bucket = 0;
+        while (bucket + 1 < std::tuple_size<Histogram>::value &&
+               (std::size_t{2} << bucket) <= size)
+            ++bucket;
+        return bucket;
+    }
+
+   private:
+    struct Slot {
+        std::uint64_t hash;  // 0 marks an empty slot
+        std::uint32_t entryIndex;
+        std::uint32_t reserved;
+    };
+
+    static std::uint64_t hash_id(std::string_view identityNumber) noexcept;
+    // Index of the slot holding identityNumber, or of the empty slot where
+    // it belongs
+    std::size_t find_slot(std::uint64_t hash,
+                          std::string_view identityNumber) const noexcept;
+
+    std::vector<Entry> _entries;
+    // At least twice the capacity, a power of two
+    std::vector<Slot> _slots;
+    std::size_t _mask;
+    std::size_t _size;
+    std::chrono::milliseconds _maxWait;
+    std::chrono::steady_clock::time_point _deadline;
+    Histogram _histogram{};
+};
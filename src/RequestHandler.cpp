@@ -1,263 +1,610 @@
 #include "RequestHandler.h"
 
+#include <algorithm>
 #include <exception>
 
+#include "AllocationCheck.h"
 #include "Config.h"
-#include "DatabaseFactory.h"
-#include "PostgreDatabase.h"
+#include "Log.h"
+#include "ResponseEncoder.h"
 #include "helper.h"
-#include "loggerlib.h"
-#include "messages/Char64str.h"
-#include "messages/IdentityMessage.h"
-#include "messages/MessageHeader.h"
+#include "messages/VerifyBatchRequest.h"
+
+static_assert(counters::VERIFY_BATCH_128_PLUS - counters::VERIFY_BATCH_1 + 1 ==
+                  std::tuple_size<RequestBatch::Histogram>::value,
+              "One counter per verify batch size bucket");
 
 namespace {
 
-void log_identity(messages::IdentityMessage &identity) {
-    qLogger::get().info_fast("msg: {}", identity.msg().getCharValAsString());
-    qLogger::get().info_fast("type: {}", identity.type().getCharValAsString());
-    qLogger::get().info_fast("id: {}", identity.id().getCharValAsString());
-    qLogger::get().info_fast("name: {}", identity.name().getCharValAsString());
-    qLogger::get().info_fast("dateOfIssue: {}",
-                             identity.dateOfIssue().getCharValAsString());
-    qLogger::get().info_fast("dateOfExpiry: {}",
-                             identity.dateOfExpiry().getCharValAsString());
-    qLogger::get().info_fast("address: {}",
-                             identity.address().getCharValAsString());
-    qLogger::get().info_fast("verified: {}",
-                             identity.verified().getCharValAsString());
+journal::Outcome outcome_of(messages::MessageKind::Value kind,
+                            bool result) noexcept {
+    if (kind == messages::MessageKind::ADD_USER_REQUEST)
+        return result ? journal::Outcome::ADDED : journal::Outcome::NOT_ADDED;
+    return result ? journal::Outcome::VERIFIED
+                  : journal::Outcome::NOT_VERIFIED;
+}
+
+// Of a request answered from memory: hits come from the cache, misses from
+// the bloom filter
+journal::Source source_of(bool found) noexcept {
+    return found ? journal::Source::CACHE : journal::Source::BLOOM_FILTER;
+}
+
+void log_batch_sizes(std::uint32_t shardId, const char *kind,
+                     const RequestBatch::Histogram &histogram) {
+    EKYC_LOG_INFO(
+        "Shard {} {} batch sizes [1, 2-3, 4-7, 8-15, 16-31, 32-63, 64-127, "
+        "128+]: {} {} {} {} {} {} {} {}",
+        shardId, kind, histogram[0], histogram[1], histogram[2], histogram[3],
+        histogram[4], histogram[5], histogram[6], histogram[7]);
 }
 
 }  // namespace
 
-RequestHandler::RequestHandler() noexcept {
+RequestHandler::RequestHandler(std::uint32_t shardId,
+                               std::uint32_t numShards,
+                               StageLatencies *latencies, CounterSet counters,
+                               ResponseSink responseSink) noexcept
+    : _shardId(shardId),
+      _numShards(numShards),
+      _latencies(latencies),
+      _counters(counters),
+      _responseSink(std::move(responseSink)),
+      _verifyBatch(
+          Config::get().VERIFY_BATCH_SIZE,
+          std::chrono::milliseconds(Config::get().VERIFY_BATCH_MAX_WAIT_MS)),
+      _addBatch(Config::get().ADD_BATCH_SIZE,
+                std::chrono::milliseconds(Config::get().SHARD_TIMEOUT_MS)) {
     auto &cfg = Config::get();
 
+    if (cfg.JOURNAL_ENABLED)
+        _journal = std::make_unique<RequestJournal>(
+            cfg.JOURNAL_DIR, shardId, cfg.JOURNAL_FILE_SIZE,
+            cfg.JOURNAL_MAX_FILES);
+
     try {
-        auto pgConfig = DatabaseConfig(cfg.DB_HOST, cfg.DB_PORT, cfg.DB_NAME,
-                                       cfg.DB_USER, cfg.DB_PASSWORD);
+        _store = IdentityStore::create(cfg.DB_BACKEND);
+        load_identity_cache();
+    } catch (const std::exception &e) {
+        // Requests are answered as not found, and adds fail, until restart
+        _store.reset();
+        EKYC_LOG_ERROR("Shard {} has no identity store ({}): {}", shardId,
+                       cfg.DB_BACKEND, e.what());
+    }
+}
 
-        auto pgDb = DatabaseFactory::create("postgresql", pgConfig);
-        _pgDbManager = std::make_unique<DatabaseManager>(std::move(pgDb));
+RequestHandler::~RequestHandler() noexcept {
+    EKYC_LOG_INFO(
+        "Shard {} identity cache: {} entries, {} bytes, {} hits, {} misses",
+        _shardId, _identityCache.size(), _identityCache.memory_usage(),
+        _identityCache.hits(), _identityCache.misses());
+    if (_bloomFilter)
+        EKYC_LOG_INFO(
+            "Shard {} bloom filter: {} items, {} bytes, {} misses answered",
+            _shardId, _bloomFilter->item_count(), _bloomFilter->size_in_bytes(),
+            _counters.get(counters::BLOOM_REJECTED));
+    log_batch_sizes(_shardId, "verify", _verifyBatch.histogram());
+    log_batch_sizes(_shardId, "add", _addBatch.histogram());
+    if (_journal)
+        EKYC_LOG_INFO("Shard {} journaled {} requests", _shardId,
+                      _journal->records());
+}
 
-        qLogger::get().info_fast("Connected to PostGreSQL");
-    } catch (const std::exception &e) {
-        qLogger::get().error_fast("Error: {}", e.what());
+// Bulk load the identities this shard is responsible for
+void RequestHandler::load_identity_cache() {
+    auto &cfg = Config::get();
+
+    // A Bloom miss is answered without asking the store, which is only sound
+    // if every insert into this partition goes through this shard
+    std::unique_ptr<BloomFilter> bloomFilter;
+    if (cfg.BLOOM_FILTER_ENABLED && !_store->sole_writer())
+        EKYC_LOG_WARNING(
+            "Shard {} bloom filter off: other writers not ruled out, see "
+            "DB_SINGLE_WRITER",
+            _shardId);
+    else if (cfg.BLOOM_FILTER_ENABLED) {
+        try {
+            bloomFilter = std::make_unique<BloomFilter>(
+                cfg.BLOOM_FILTER_EXPECTED_ITEMS / _numShards + 1,
+                cfg.BLOOM_FILTER_FP_RATE);
+        } catch (const std::exception &e) {
+            // Only costs the DB round trips the filter would have saved
+            EKYC_LOG_WARNING(
+                "Shard {} bloom filter off: cannot allocate it for {} "
+                "items ({}), check BLOOM_FILTER_EXPECTED_ITEMS",
+                _shardId, cfg.BLOOM_FILTER_EXPECTED_ITEMS, e.what());
+        }
+    }
+
+    const std::size_t rows = _store->for_each_identity(
+        [&](std::string_view identityNumber, std::string_view name) {
+            if (shard_for_identity(identityNumber.data(),
+                                   identityNumber.size(),
+                                   _numShards) != _shardId)
+                return;
+
+            _identityCache.insert(identityNumber, name);
+            if (bloomFilter) bloomFilter->add(identityNumber);
+        });
+
+    EKYC_LOG_INFO("Shard {} loaded {} of {} identities into cache ({} bytes)",
+                  _shardId, _identityCache.size(), rows,
+                  _identityCache.memory_usage());
+
+    if (bloomFilter) {
+        EKYC_LOG_INFO(
+            "Shard {} bloom filter: {} bytes, {} hashes, target FP rate {}",
+            _shardId, bloomFilter->size_in_bytes(), bloomFilter->hash_count(),
+            cfg.BLOOM_FILTER_FP_RATE);
+        if (bloomFilter->item_count() * _numShards >
+            cfg.BLOOM_FILTER_EXPECTED_ITEMS)
+            EKYC_LOG_WARNING(
+                "Shard {} bloom filter over capacity, raise "
+                "BLOOM_FILTER_EXPECTED_ITEMS",
+                _shardId);
+        // Only trusted for negatives once it covers the whole partition
+        _bloomFilter = std::move(bloomFilter);
     }
 }
 
-RequestHandler::~RequestHandler() noexcept {}
-
-std::vector<char> RequestHandler::respond(
-    const aeron_wrapper::FragmentData &fragmentData) noexcept {
-    std::vector<char> buffer;
-
-    messages::MessageHeader msgHeader;
-    char *base = reinterpret_cast<char *>(
-        const_cast<uint8_t *>(fragmentData.atomicBuffer.buffer()));
-    char *start = base + fragmentData.offset;
-
-    msgHeader.wrap(start, 0, 0, fragmentData.length);
-    size_t offset = msgHeader.encodedLength();
-
-    if (msgHeader.templateId() == messages::IdentityMessage::sbeTemplateId()) {
-        messages::IdentityMessage identity;
-        identity.wrapForDecode(start, offset, msgHeader.blockLength(),
-                               msgHeader.version(), fragmentData.length);
-        log_identity(identity);
-
-        std::string msgType = identity.msg().getCharValAsString();
-        bool isVerified =
-            string_to_bool(identity.verified().getCharValAsString());
-
-        // Check if this is an "Identity Verification Request" with
-        // verified=false
-        if (msgType == "Identity Verification Request" && !isVerified) {
-            std::string name = identity.name().getCharValAsString();
-            std::string id = identity.id().getCharValAsString();
-
-            qLogger::get().info_fast(
-                "Processing Identity Verification Request for: {} {}", name,
-                id);
-
-            // Invoke verification method
-            bool userExist = exist_user(id, name);
-
-            if (userExist) {
-                qLogger::get().info_fast("Verification successful for {} {}",
-                                         name, id);
-                // Send back verified message with verified=true
-                buffer = get_buffer(identity, true);
-            } else {
-                qLogger::get().info_fast("Verification failed for {} {}", name,
-                                         id);
-                // Send back message with verified=false
-                buffer = get_buffer(identity, false);
+void RequestHandler::respond(char *start, std::uint64_t length,
+                             std::uint64_t receiveTimeNs) noexcept {
+    // Requests answered from memory must not touch the heap in steady
+    // state; paths that queue for or go to the DB opt out
+    AllocationCheck allocationCheck;
+
+    IdentityRequest request;
+    request.receiveTimeNs = receiveTimeNs;
+    StageTimer decodeTimer(_latencies, Stage::DECODE);
+    try {
+        // Into our own copy of the request, so batched entries keep it
+        stamp_receive_time(start, length, receiveTimeNs);
+        // Either template, negotiated by templateId
+        if (!request.decode(start, length)) {
+            if (request.templateId ==
+                messages::VerifyBatchRequest::sbeTemplateId()) {
+                decodeTimer.stop();
+                verify_group(start, length, receiveTimeNs);
+                return;
             }
+            EKYC_LOG_ERROR("[Decoder] Unexpected template ID: {}",
+                           request.templateId);
+            return;
+        }
+    } catch (const std::exception &e) {
+        AllocationCheck::allow();
+        EKYC_LOG_ERROR("[Decoder] Malformed request: {}", e.what());
+        return;
+    }
+    decodeTimer.stop();
+    // Requests are journaled rather than logged, see RequestJournal
+    if (request.verified) {
+        if (_journal)
+            _journal->append(request, journal::Outcome::ALREADY_VERIFIED,
+                             journal::Source::NONE);
+        return;
+    }
+
+    switch (request.kind) {
+        case messages::MessageKind::VERIFICATION_REQUEST:
+            // Answered now if cached, otherwise queued for the next batch
+            verify_identity(request);
+            break;
+        case messages::MessageKind::ADD_USER_REQUEST:
+            // Answered when the add batch is written
+            queue_identity(request);
+            break;
+        default:
+            if (_journal)
+                _journal->append(request, journal::Outcome::IGNORED,
+                                 journal::Source::NONE);
+            break;
+    }
+}
+
+std::size_t RequestHandler::poll() noexcept {
+    std::size_t workCount = 0;
+    if (_verifyBatch.due()) workCount += flush_verifications();
+    if (_addBatch.due()) workCount += flush_adds();
+    return workCount;
+}
+
+std::size_t RequestHandler::flush() noexcept {
+    return flush_verifications() + flush_adds();
+}
+
+// Flag in _batchResults, zeroed by the caller, which of the first count
+// pairs of _batchIds and _batchNames exist, with a single statement. Throws
+// on DB errors.
+void RequestHandler::find_existing(std::size_t count) {
+    if (!_store || count == 0) return;
+
+    AllocationCheck::allow();
+    StageTimer lookupTimer(_latencies, Stage::LOOKUP);
+    _batchIds.resize(count);
+    _batchNames.resize(count);
+    _store->find_existing(_batchIds, _batchNames, _batchResults.data());
+}
+
+// Answer a whole VerifyBatchRequest with one response. Entries of this
+// shard's partition are answered from memory where possible, everything
+// else is resolved by one statement, after Shard has had their owners
+// answer what they received before the batch.
+void RequestHandler::verify_group(char *start, std::size_t length,
+                                  std::uint64_t receiveTimeNs) noexcept {
+    // Sizes the scratch vectors to the batch
+    AllocationCheck::allow();
+
+    // An earlier add for any of these identities must be visible, and the
+    // flush reuses the scratch vectors below
+    if (!_addBatch.empty()) flush_adds();
+
+    std::size_t count = 0;
+    std::size_t pending = 0;
+    std::uint64_t batchId = 0;
+    _groupPending.clear();
+    try {
+        messages::MessageHeader msgHeader(start, length);
+        messages::VerifyBatchRequest batch;
+        batch.wrapForDecode(start, msgHeader.encodedLength(),
+                            msgHeader.blockLength(), msgHeader.version(),
+                            length);
+        batchId = batch.batchId();
+
+        auto &entries = batch.entries();
+        count = entries.count();
+        _groupResults.assign(count, 0);
+        if (_batchIds.size() < count) {
+            _batchIds.resize(count);
+            _batchNames.resize(count);
         }
-        // Check if this is an "Add User in System" request with verified=false
-        else if (msgType == "Add User in System" && !isVerified) {
-            std::string name = identity.name().getCharValAsString();
-            std::string id = identity.id().getCharValAsString();
-
-            qLogger::get().info_fast(
-                "Processing Add User in System request for: {} {}", name, id);
-
-            // Add user to database
-            bool identityAdded = add_identity(identity);
-
-            if (identityAdded) {
-                qLogger::get().info_fast("User addition successful for {} {}",
-                                         name, id);
-                // Send back response with verified=true (user added
-                // successfully)
-                buffer = get_buffer(identity, true);
-            } else {
-                qLogger::get().info_fast("User addition failed for {} {}", name,
-                                         id);
-                // Send back response with verified=false (user addition failed)
-                buffer = get_buffer(identity, false);
+
+        for (std::size_t i = 0; i < count; ++i) {
+            entries.next();
+            // Staged in the next free slot, kept only if the DB is needed
+            auto &identityNumber = _batchIds[pending];
+            auto &name = _batchNames[pending];
+            identityNumber = entries.getIdAsStringView();
+            name = entries.getNameAsStringView();
+
+            // The cache and bloom filter only cover this shard's partition
+            if (shard_for_identity(identityNumber.data(),
+                                   identityNumber.size(),
+                                   _numShards) == _shardId) {
+                const Lookup lookup = lookup_cached(identityNumber, name);
+                if (lookup != Lookup::UNKNOWN) {
+                    const bool found = lookup == Lookup::FOUND;
+                    _groupResults[i] = found;
+                    if (_journal)
+                        _journal->append(
+                            batchId, identityNumber, name, receiveTimeNs,
+                            found ? journal::Outcome::VERIFIED
+                                  : journal::Outcome::NOT_VERIFIED,
+                            source_of(found));
+                    continue;
+                }
             }
-        } else if (isVerified) {
-            qLogger::get().info_fast("Identity already verified: {}",
-                                     identity.name().getCharValAsString());
-        } else {
-            qLogger::get().info_fast("Message type '{}' - no action needed",
-                                     msgType);
+            _groupPending.push_back(i);
+            ++pending;
         }
-    } else {
-        qLogger::get().error_fast("[Decoder] Unexpected template ID: {}",
-                                  msgHeader.templateId());
+    } catch (const std::exception &e) {
+        EKYC_LOG_ERROR("[Decoder] Malformed batch request: {}", e.what());
+        return;
+    }
+
+    _batchResults.assign(pending, 0);
+    try {
+        find_existing(pending);
+    } catch (const std::exception &e) {
+        _counters.increment(counters::DB_ERRORS);
+        EKYC_LOG_ERROR("Database query error during batch verification: {}",
+                       e.what());
+    }
+
+    for (std::size_t k = 0; k < pending; ++k) {
+        const bool found = _batchResults[k] != 0;
+        const auto &identityNumber = _batchIds[k];
+        if (_journal)
+            _journal->append(batchId, identityNumber, _batchNames[k],
+                             receiveTimeNs,
+                             found ? journal::Outcome::VERIFIED
+                                   : journal::Outcome::NOT_VERIFIED,
+                             journal::Source::DATABASE);
+        if (!found) continue;
+        _groupResults[_groupPending[k]] = 1;
+
+        // Added behind our back, e.g. by another engine instance
+        if (shard_for_identity(identityNumber.data(), identityNumber.size(),
+                               _numShards) == _shardId)
+            _identityCache.insert(identityNumber, _batchNames[k]);
     }
-    return buffer;
+
+    EKYC_LOG_DEBUG(
+        "Shard {} resolved verification group {} of {}, {} from the database",
+        _shardId, batchId, count, pending);
+
+    const auto verified = static_cast<std::size_t>(
+        std::count(_groupResults.begin(), _groupResults.end(), 1));
+    _counters.add(counters::VERIFIED, verified);
+    _counters.add(counters::NOT_VERIFIED, count - verified);
+
+    _responseSink(start, length, _groupResults.data(), count);
 }
 
-// Check if user exists in database
-bool RequestHandler::exist_user(const std::string &identityNumber,
-                                const std::string &name) noexcept {
+std::size_t RequestHandler::flush_verifications() noexcept {
+    const std::size_t count = _verifyBatch.size();
+    if (count == 0) return 0;
+
+    // Sizes the array parameters, then goes to the DB
+    AllocationCheck::allow();
+    _batchResults.assign(count, 0);
     try {
-        std::string selectQuery =
-            "SELECT identity_number, name FROM users WHERE identity_number = "
-            "'" +
-            identityNumber + "' AND name = '" + name + "'";
-
-        auto res = (*_pgDbManager)->exec(selectQuery);
-        if (!res) {
-            qLogger::get().error_fast("DB exec returned null");
-            return false;
+        _batchIds.resize(count);
+        _batchNames.resize(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            _batchIds[i] = _verifyBatch[i].identityNumber;
+            _batchNames[i] = _verifyBatch[i].name;
+        }
+        find_existing(count);
+    } catch (const std::exception &e) {
+        _counters.increment(counters::DB_ERRORS);
+        EKYC_LOG_ERROR("Database query error during batch verification: {}",
+                       e.what());
+    }
+
+    EKYC_LOG_DEBUG("Shard {} resolved verification batch of {}", _shardId,
+                   count);
+    _counters.increment(counters::VERIFY_BATCH_1 +
+                        RequestBatch::bucket_of(count));
+
+    for (std::size_t i = 0; i < count; ++i) {
+        auto &entry = _verifyBatch[i];
+        const bool exists = _batchResults[i] != 0;
+        // Added behind our back, e.g. by another engine instance
+        if (exists) _identityCache.insert(entry.identityNumber, entry.name);
+
+        reply(entry, exists);
+    }
+
+    _verifyBatch.clear();
+    return count;
+}
+
+std::size_t RequestHandler::flush_adds() noexcept {
+    const std::size_t count = _addBatch.size();
+    if (count == 0) return 0;
+
+    AllocationCheck::allow();
+    bool written = false;
+    _batchResults.assign(count, 0);
+    if (_store) {
+        try {
+            _batchTypes.resize(count);
+            _batchIds.resize(count);
+            _batchNames.resize(count);
+            _batchDatesOfIssue.resize(count);
+            _batchDatesOfExpiry.resize(count);
+            _batchAddresses.resize(count);
+            for (std::size_t i = 0; i < count; ++i) {
+                const auto &entry = _addBatch[i];
+                _batchTypes[i] = entry.type;
+                _batchIds[i] = entry.identityNumber;
+                _batchNames[i] = entry.name;
+                _batchDatesOfIssue[i] = entry.dateOfIssue;
+                _batchDatesOfExpiry[i] = entry.dateOfExpiry;
+                _batchAddresses[i] = entry.address;
+            }
+
+            StageTimer lookupTimer(_latencies, Stage::LOOKUP);
+            _store->add_batch(_batchTypes, _batchIds, _batchNames,
+                              _batchDatesOfIssue, _batchDatesOfExpiry,
+                              _batchAddresses, _batchResults.data());
+            written = true;
+        } catch (const std::exception &e) {
+            _counters.increment(counters::DB_ERRORS);
+            EKYC_LOG_WARNING(
+                "Database error during batch add, retrying row by row: {}",
+                e.what());
         }
+    }
 
-        auto pgResult = dynamic_cast<PostgreResult *>(res.get());
-        if (!pgResult) {
-            qLogger::get().error_fast("Unexpected DB result type");
-            return false;
+    EKYC_LOG_DEBUG("Shard {} resolved add batch of {}", _shardId, count);
+
+    for (std::size_t i = 0; i < count; ++i) {
+        auto &entry = _addBatch[i];
+
+        bool identityAdded;
+        if (written) {
+            // Write-through: present in the DB either way from here on
+            _identityCache.insert(entry.identityNumber, entry.name);
+            if (_bloomFilter) _bloomFilter->add(entry.identityNumber);
+            identityAdded = _batchResults[i] != 0;
+        } else {
+            // One bad row fails the whole statement, isolate it
+            identityAdded = add_identity(entry.fields());
         }
 
-        bool exists = !pgResult->empty();
+        // verified=true only if the user was added by this request
+        reply(entry, identityAdded);
+    }
 
-        qLogger::get().info_fast(
-            exists ? "Verified: {} {} found in database"
-                   : "NOT verified: {} {} not found in database",
-            identityNumber, name);
+    _addBatch.clear();
+    return count;
+}
 
-        return exists;
+void RequestHandler::verify_identity(const IdentityRequest &request) noexcept {
+    const auto identityNumber = request.fields.identityNumber;
+    const auto name = request.fields.name;
+
+    // An earlier add for this identity must be visible to the lookup
+    if (_addBatch.contains(identityNumber)) flush_adds();
+
+    // Answering from the cache would overtake an earlier request for the
+    // same identity that is still waiting for the DB
+    if (!_verifyBatch.contains(identityNumber)) {
+        const Lookup lookup = lookup_cached(identityNumber, name);
+        if (lookup != Lookup::UNKNOWN) {
+            const bool found = lookup == Lookup::FOUND;
+            reply(request, found, source_of(found));
+            return;
+        }
+    }
+
+    if (_verifyBatch.capacity() == 1) {
+        reply(request, query_user(identityNumber, name),
+              journal::Source::DATABASE);
+        return;
+    }
+
+    try {
+        _verifyBatch.push(request);
     } catch (const std::exception &e) {
-        qLogger::get().error_fast(
-            "Database query error during user existence check: {}", e.what());
-        return false;
+        EKYC_LOG_ERROR("Error: {}", e.what());
+        return;
     }
+    if (_verifyBatch.full()) flush_verifications();
 }
 
-// Add user to database
-bool RequestHandler::add_identity(
-    messages::IdentityMessage &identity) noexcept {
+void RequestHandler::queue_identity(const IdentityRequest &request) noexcept {
+    // An earlier verification for this identity must not observe this add
+    if (_verifyBatch.contains(request.fields.identityNumber))
+        flush_verifications();
+
+    if (_addBatch.capacity() == 1) {
+        reply(request, add_identity(request.fields),
+              journal::Source::DATABASE);
+        return;
+    }
+
     try {
-        std::string type = identity.type().getCharValAsString();
-        std::string identityNumber = identity.id().getCharValAsString();
-        std::string name = identity.name().getCharValAsString();
-        std::string dateOfIssue = identity.dateOfIssue().getCharValAsString();
-        std::string dateOfExpiry = identity.dateOfExpiry().getCharValAsString();
-        std::string address = identity.address().getCharValAsString();
-
-        qLogger::get().info_fast(
-            "Adding user to system: name={}, id={}, type={}", name,
-            identityNumber, type);
-
-        // Check if user already exists using the reusable method
-        if (exist_user(identityNumber, name)) {
-            qLogger::get().info_fast(
-                "User already exists in system: {} {} ({})", name,
-                identityNumber, type);
-            return false;  // User already exists, don't add duplicate
-        }
+        _addBatch.push(request);
+    } catch (const std::exception &e) {
+        EKYC_LOG_ERROR("Error: {}", e.what());
+        return;
+    }
+    if (_addBatch.full()) flush_adds();
+}
+
+void RequestHandler::reply(const IdentityRequest &request, bool result,
+                           journal::Source source) noexcept {
+    const std::uint8_t flag = result ? 1 : 0;
+    _responseSink(request.buffer, request.length, &flag, 1);
+    if (request.kind == messages::MessageKind::ADD_USER_REQUEST)
+        _counters.increment(result ? counters::ADDED : counters::NOT_ADDED);
+    else
+        _counters.increment(result ? counters::VERIFIED
+                                   : counters::NOT_VERIFIED);
+    if (_journal)
+        _journal->append(request, outcome_of(request.kind, result), source);
+}
+
+// A batched request, answered from its saved copy
+void RequestHandler::reply(const RequestBatch::Entry &entry,
+                           bool result) noexcept {
+    IdentityRequest request;
+    try {
+        // Decoded once already on arrival, so this cannot fail in practice
+        char *start = const_cast<char *>(entry.request.data());
+        request.decode(start, entry.request.size());
+    } catch (const std::exception &e) {
+        EKYC_LOG_ERROR("[Decoder] Malformed batched request: {}", e.what());
+        return;
+    }
+    request.receiveTimeNs = entry.receiveTimeNs;
+    reply(request, result, journal::Source::DATABASE);
+}
 
-        qLogger::get().info_fast(
-            "User not found in system, proceeding with addition: {} {}", name,
-            identityNumber);
+// Answer from memory when possible: cache hits and bloom filter misses
+RequestHandler::Lookup RequestHandler::lookup_cached(
+    std::string_view identityNumber, std::string_view name) noexcept {
+    StageTimer lookupTimer(_latencies, Stage::LOOKUP);
+    if (_identityCache.contains(identityNumber, name)) {
+        _counters.increment(counters::CACHE_HITS);
+        return Lookup::FOUND;
+    }
+    _counters.increment(counters::CACHE_MISSES);
 
-        // Insert user into database
-        std::string insertQuery =
-            "INSERT INTO users (type, identity_number, name, date_of_issue, "
-            "date_of_expiry, address) "
-            "VALUES ('" +
-            type + "', '" + identityNumber + "', '" + name + "', '" +
-            dateOfIssue + "', '" + dateOfExpiry + "', '" + address + "')";
+    if (_bloomFilter && !_bloomFilter->might_contain(identityNumber)) {
+        _counters.increment(counters::BLOOM_REJECTED);
+        return Lookup::NOT_FOUND;
+    }
+    return Lookup::UNKNOWN;
+}
 
-        (*_pgDbManager)->exec(insertQuery);
+// Check if user exists in database
+bool RequestHandler::exist_user(std::string_view identityNumber,
+                                std::string_view name) noexcept {
+    const Lookup lookup = lookup_cached(identityNumber, name);
+    if (lookup != Lookup::UNKNOWN) return lookup == Lookup::FOUND;
+    return query_user(identityNumber, name);
+}
 
-        qLogger::get().info_fast(
-            "User successfully added to system: {} {} ({})", name,
-            identityNumber, type);
+// Ask the database alone, bypassing the cache
+bool RequestHandler::query_user(std::string_view identityNumber,
+                                std::string_view name) noexcept {
+    if (!_store) return false;
 
-        return true;
+    AllocationCheck::allow();
+    StageTimer lookupTimer(_latencies, Stage::LOOKUP);
+    try {
+        const bool exists = _store->exists(identityNumber, name);
+        // Added behind our back, e.g. by another engine instance
+        if (exists) _identityCache.insert(identityNumber, name);
+        return exists;
+    } catch (const std::exception &e) {
+        _counters.increment(counters::DB_ERRORS);
+        EKYC_LOG_ERROR("Database query error during user existence check: {}",
+                       e.what());
+        return false;
+    }
+}
+
+// Add user to database
+bool RequestHandler::add_identity(const IdentityFields &identity) noexcept {
+    if (!_store) return false;
+
+    AllocationCheck::allow();
+    StageTimer lookupTimer(_latencies, Stage::LOOKUP);
+    try {
+        // False if the user already exists, not added twice
+        const bool added = _store->add(identity);
+
+        // Write-through: present in the DB either way from here on
+        _identityCache.insert(identity.identityNumber, identity.name);
+        if (_bloomFilter) _bloomFilter->add(identity.identityNumber);
+        return added;
     } catch (const std::exception &e) {
-        qLogger::get().error_fast("Database error while adding user: {}",
-                                  e.what());
+        _counters.increment(counters::DB_ERRORS);
+        EKYC_LOG_ERROR("Database error while adding user: {}", e.what());
         return false;
     }
 }
 
-// Send response message
-std::vector<char> RequestHandler::get_buffer(
-    messages::IdentityMessage &originalIdentity,
-    bool verificationResult) noexcept {
-    std::vector<char> buffer;
+std::size_t RequestHandler::response_length(
+    const char *request, std::size_t requestLength) noexcept {
     try {
-        using namespace messages;
-        const size_t bufferCapacity =
-            MessageHeader::encodedLength() + IdentityMessage::sbeBlockLength();
-        buffer.resize(bufferCapacity);
-        size_t offset = 0;
-
-        // Encode header
-        MessageHeader msgHeader;
-        msgHeader.wrap(buffer.data(), offset, 0, bufferCapacity);
-        msgHeader.blockLength(IdentityMessage::sbeBlockLength());
-        msgHeader.templateId(IdentityMessage::sbeTemplateId());
-        msgHeader.schemaId(IdentityMessage::sbeSchemaId());
-        msgHeader.version(IdentityMessage::sbeSchemaVersion());
-        offset += msgHeader.encodedLength();
-
-        // Encode response message
-        IdentityMessage identity;
-        identity.wrapForEncode(buffer.data(), offset, bufferCapacity);
-
-        // Copy original data but update verification status and message
-        identity.msg().putCharVal("Identity Verification Response");
-        identity.type().putCharVal(
-            originalIdentity.type().getCharValAsString());
-        identity.id().putCharVal(originalIdentity.id().getCharValAsString());
-        identity.name().putCharVal(
-            originalIdentity.name().getCharValAsString());
-        identity.dateOfIssue().putCharVal(
-            originalIdentity.dateOfIssue().getCharValAsString());
-        identity.dateOfExpiry().putCharVal(
-            originalIdentity.dateOfExpiry().getCharValAsString());
-        identity.address().putCharVal(
-            originalIdentity.address().getCharValAsString());
-        identity.verified().putCharVal(verificationResult ? "true" : "false");
+        return response_encoder::response_length(request, requestLength);
     } catch (const std::exception &e) {
-        qLogger::get().error_fast("Error sending response: {}", e.what());
+        AllocationCheck::allow();
+        EKYC_LOG_ERROR("Error sizing response: {}", e.what());
+        return 0;
+    }
+}
+
+// Encode response message
+bool RequestHandler::encode_response(char *buffer, std::size_t length,
+                                     const char *request,
+                                     std::size_t requestLength,
+                                     const std::uint8_t *results,
+                                     std::size_t resultCount,
+                                     std::uint64_t sendTimeNs) noexcept {
+    try {
+        response_encoder::encode(buffer, length, request, requestLength,
+                                 results, resultCount, sendTimeNs);
+        return true;
+    } catch (const std::exception &e) {
+        AllocationCheck::allow();
+        EKYC_LOG_ERROR("Error encoding response: {}", e.what());
+        return false;
     }
-    return buffer;
 }
@@ -1,32 +1,118 @@
 #pragma once
 
 #include <atomic>
+#include <cstdint>
+#include <functional>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <vector>
 
-#include "DatabaseManager.h"
-#include "aeron_wrapper.h"
-
-// Forward declaration
-namespace messages {
-class IdentityMessage;
-}
+#include "BloomFilter.h"
+#include "CountersFile.h"
+#include "IdentityCache.h"
+#include "IdentityRequest.h"
+#include "IdentityStore.h"
+#include "JournalRecord.h"
+#include "LatencyHistogram.h"
+#include "RequestBatch.h"
+#include "RequestJournal.h"
 
 class RequestHandler final {
    public:
-    RequestHandler() noexcept;
+    // Receives every answered request (the SBE message as received) and one
+    // result per identity it carries, possibly after respond() has returned,
+    // so the response can be encoded straight into the transport's buffer
+    using ResponseSink = std::function<void(
+        const char *, std::size_t, const std::uint8_t *, std::size_t)>;
+
+    // Serves the identities routed to shardId out of numShards, timing its
+    // stages into latencies unless null and counting outcomes into counters
+    RequestHandler(std::uint32_t shardId, std::uint32_t numShards,
+                   StageLatencies *latencies, CounterSet counters,
+                   ResponseSink responseSink) noexcept;
     ~RequestHandler() noexcept;
 
-    std::vector<char> respond(
-        const aeron_wrapper::FragmentData &fragmentData) noexcept;
+    // receiveTimeNs is when the engine received the request, echoed in its
+    // response for latency breakdowns
+    void respond(char *buffer, std::uint64_t length,
+                 std::uint64_t receiveTimeNs) noexcept;
+
+    // Resolve pending batches that are due, returns the number of requests
+    // answered
+    std::size_t poll() noexcept;
+    // Resolve everything pending regardless of deadlines
+    std::size_t flush() noexcept;
 
-    bool exist_user(const std::string &identityNumber,
-                    const std::string &name) noexcept;
-    bool add_identity(messages::IdentityMessage &identity) noexcept;
-    std::vector<char> get_buffer(messages::IdentityMessage &originalIdentity,
-                                 bool verificationResult) noexcept;
+    bool exist_user(std::string_view identityNumber,
+                    std::string_view name) noexcept;
+    bool add_identity(const IdentityFields &identity) noexcept;
+
+    // Bytes needed by encode_response, 0 if the request is malformed
+    static std::size_t response_length(const char *request,
+                                       std::size_t requestLength) noexcept;
+    // Encode the response to request into buffer, which must hold
+    // response_length() bytes. Uses the request's template, or
+    // VerifyBatchResponse for batches.
+    static bool encode_response(char *buffer, std::size_t length,
+                                const char *request,
+                                std::size_t requestLength,
+                                const std::uint8_t *results,
+                                std::size_t resultCount,
+                                std::uint64_t sendTimeNs) noexcept;
 
    private:
-    std::unique_ptr<DatabaseManager> _pgDbManager;
+    enum class Lookup { FOUND, NOT_FOUND, UNKNOWN };
+
+    void load_identity_cache();
+
+    Lookup lookup_cached(std::string_view identityNumber,
+                         std::string_view name) noexcept;
+    bool query_user(std::string_view identityNumber,
+                    std::string_view name) noexcept;
+    void verify_identity(const IdentityRequest &request) noexcept;
+    void queue_identity(const IdentityRequest &request) noexcept;
+    void verify_group(char *start, std::size_t length,
+                      std::uint64_t receiveTimeNs) noexcept;
+    void find_existing(std::size_t count);
+    std::size_t flush_verifications() noexcept;
+    std::size_t flush_adds() noexcept;
+    // Send the response and journal the outcome
+    void reply(const IdentityRequest &request, bool result,
+               journal::Source source) noexcept;
+    void reply(const RequestBatch::Entry &entry, bool result) noexcept;
+
+    // Null if the DB_BACKEND could not be reached
+    std::unique_ptr<IdentityStore> _store;
+
+    const std::uint32_t _shardId;
+    const std::uint32_t _numShards;
+    StageLatencies *const _latencies;
+    CounterSet _counters;
+
+    // Write-through cache of known identities for this shard's partition
+    IdentityCache _identityCache;
+    // Identity numbers of the partition, null until fully loaded
+    std::unique_ptr<BloomFilter> _bloomFilter;
+
+    ResponseSink _responseSink;
+    // One record per answered request, null if JOURNAL_ENABLED is off
+    std::unique_ptr<RequestJournal> _journal;
+
+    // Verifications that need the DB and adds, each resolved by one
+    // statement per batch (see RequestBatch for when a batch is due)
+    RequestBatch _verifyBatch;
+    RequestBatch _addBatch;
+    // Array parameters and per-entry results, reused across batches
+    std::vector<std::string> _batchTypes;
+    std::vector<std::string> _batchIds;
+    std::vector<std::string> _batchNames;
+    std::vector<std::string> _batchDatesOfIssue;
+    std::vector<std::string> _batchDatesOfExpiry;
+    std::vector<std::string> _batchAddresses;
+    std::vector<std::uint8_t> _batchResults;
+    // Per-entry results of a VerifyBatchRequest, and the entries that went
+    // to the DB
+    std::vector<std::uint8_t> _groupResults;
+    std::vector<std::size_t> _groupPending;
 };
@@ -0,0 +1,316 @@
+#include "RequestJournal.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <charconv>
+#include <cstring>
+#include <exception>
+#include <filesystem>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include "Log.h"
+#include "helper.h"
+#include "messages/VerifyBatchRequest.h"
+
+namespace {
+
+// NUL padded, truncated to the field width
+template <std::size_t N>
+void put(char (&field)[N], std::string_view value) noexcept {
+    const std::size_t length = std::min(value.size(), N);
+    std::memcpy(field, value.data(), length);
+    std::memset(field + length, 0, N - length);
+}
+
+constexpr std::string_view FILE_SUFFIX = ".journal";
+
+// The creation time in a journal file name, false if name is not one of
+// prefix's files
+bool parse_created_ns(std::string_view name, std::string_view prefix,
+                      std::uint64_t &createdNs) noexcept {
+    if (name.size() <= prefix.size() + FILE_SUFFIX.size() ||
+        name.substr(0, prefix.size()) != prefix ||
+        name.substr(name.size() - FILE_SUFFIX.size()) != FILE_SUFFIX)
+        return false;
+
+    const char *first = name.data() + prefix.size();
+    const char *last = name.data() + name.size() - FILE_SUFFIX.size();
+    const auto result = std::from_chars(first, last, createdNs);
+    return result.ec == std::errc() && result.ptr == last;
+}
+
+}  // namespace
+
+RequestJournal::RequestJournal(std::string directory, std::uint32_t shardId,
+                               std::size_t fileSize,
+                               std::size_t maxFiles) noexcept
+    : _directory(std::move(directory)),
+      _shardId(shardId),
+      _capacity(std::max<std::size_t>(
+          fileSize > sizeof(journal::JournalHeader)
+              ? (fileSize - sizeof(journal::JournalHeader)) /
+                    sizeof(journal::JournalRecord)
+              : 0,
+          1)),
+      _maxFiles(std::max<std::size_t>(maxFiles, 1)) {
+    // Here rather than on the first request, deleting can take a while
+    try {
+        adopt_existing_files(_maxFiles - 1);
+    } catch (const std::exception &e) {
+        EKYC_LOG_ERROR("Shard {} journal could not prune {}: {}", _shardId,
+                       _directory, e.what());
+    }
+
+    if (!create_file(_current)) {
+        _failed = true;
+        return;
+    }
+    _records = reinterpret_cast<journal::JournalRecord *>(
+        static_cast<char *>(_current.mapping) +
+        sizeof(journal::JournalHeader));
+
+    try {
+        _housekeeper = std::thread([this]() { prepare_files(); });
+    } catch (const std::exception &e) {
+        // The first file is still written, there is just no next one
+        _failed = true;
+        EKYC_LOG_ERROR("Shard {} journal will not rotate: {}", _shardId,
+                       e.what());
+    }
+}
+
+RequestJournal::~RequestJournal() noexcept {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stopping = true;
+    }
+    _changed.notify_all();
+    if (_housekeeper.joinable()) _housekeeper.join();
+
+    // Left here if there was no housekeeper to take it
+    close_file(_retired, _retiredRecords);
+    close_file(_current, _index);
+    // Prepared but never written to
+    if (_spare.mapping) {
+        close_file(_spare, 0);
+        std::error_code ec;
+        std::filesystem::remove(_spare.path, ec);
+    }
+}
+
+void RequestJournal::append(const IdentityRequest &request,
+                            journal::Outcome outcome,
+                            journal::Source source) noexcept {
+    journal::JournalRecord *record = next();
+    if (!record) return;
+
+    record->receiveTimeNs = request.receiveTimeNs;
+    record->completeTimeNs = epoch_nanos();
+    record->correlationId = request.correlationId;
+    record->templateId = request.templateId;
+    record->kind = static_cast<std::uint8_t>(request.kind);
+    record->outcome = outcome;
+    record->source = source;
+    std::memset(record->reserved, 0, sizeof(record->reserved));
+    put(record->type, request.fields.type);
+    put(record->identityNumber, request.fields.identityNumber);
+    put(record->name, request.fields.name);
+    put(record->dateOfIssue, request.fields.dateOfIssue);
+    put(record->dateOfExpiry, request.fields.dateOfExpiry);
+    put(record->address, request.fields.address);
+    // Written last so a reader never sees a half-filled record as valid
+    record->sequence = _sequence;
+}
+
+void RequestJournal::append(std::uint64_t batchId,
+                            std::string_view identityNumber,
+                            std::string_view name, std::uint64_t receiveTimeNs,
+                            journal::Outcome outcome,
+                            journal::Source source) noexcept {
+    journal::JournalRecord *record = next();
+    if (!record) return;
+
+    record->receiveTimeNs = receiveTimeNs;
+    record->completeTimeNs = epoch_nanos();
+    record->correlationId = batchId;
+    record->templateId = messages::VerifyBatchRequest::sbeTemplateId();
+    record->kind = messages::MessageKind::VERIFICATION_REQUEST;
+    record->outcome = outcome;
+    record->source = source;
+    std::memset(record->reserved, 0, sizeof(record->reserved));
+    put(record->type, {});
+    put(record->identityNumber, identityNumber);
+    put(record->name, name);
+    put(record->dateOfIssue, {});
+    put(record->dateOfExpiry, {});
+    put(record->address, {});
+    record->sequence = _sequence;
+}
+
+journal::JournalRecord *RequestJournal::next() noexcept {
+    if (_records && _index == _capacity) rotate();
+    if (!_records) return nullptr;
+
+    ++_sequence;
+    return &_records[_index++];
+}
+
+void RequestJournal::rotate() noexcept {
+    std::unique_lock<std::mutex> lock(_mutex);
+    // Only waits if a whole file filled before the next one was mapped
+    _changed.wait(lock, [this]() { return _spare.mapping || _failed; });
+
+    // The housekeeper closes the previous retired file before it prepares
+    // a spare, so the slot is free
+    _retired = std::move(_current);
+    _retiredRecords = _index;
+    _current = std::move(_spare);
+    _spare = MappedFile();
+    _records = _current.mapping
+                   ? reinterpret_cast<journal::JournalRecord *>(
+                         static_cast<char *>(_current.mapping) +
+                         sizeof(journal::JournalHeader))
+                   : nullptr;
+    _index = 0;
+    lock.unlock();
+    _changed.notify_all();
+}
+
+void RequestJournal::prepare_files() noexcept {
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (true) {
+        _changed.wait(lock, [this]() {
+            return _stopping || _retired.mapping ||
+                   (!_spare.mapping && !_failed);
+        });
+
+        if (_retired.mapping) {
+            MappedFile retired = std::move(_retired);
+            _retired = MappedFile();
+            const std::size_t records = _retiredRecords;
+            lock.unlock();
+            close_file(retired, records);
+            lock.lock();
+            continue;
+        }
+        if (_stopping) return;
+
+        lock.unlock();
+        MappedFile spare;
+        const bool created = create_file(spare);
+        // Files with records kept at maxFiles, besides the empty spare
+        if (created) prune(_maxFiles + 1);
+        lock.lock();
+
+        if (created)
+            _spare = std::move(spare);
+        else
+            _failed = true;
+        _changed.notify_all();
+    }
+}
+
+bool RequestJournal::create_file(MappedFile &file) noexcept {
+    std::string path;
+    int fd = -1;
+    try {
+        const std::uint64_t createdNs = epoch_nanos();
+        std::filesystem::create_directories(_directory);
+        path = _directory + "/" + file_prefix() + std::to_string(createdNs) +
+               std::string(FILE_SUFFIX);
+
+        fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+        if (fd < 0)
+            throw std::system_error(errno, std::generic_category(), path);
+
+        const std::size_t length = sizeof(journal::JournalHeader) +
+                                   _capacity * sizeof(journal::JournalRecord);
+        if (::ftruncate(fd, static_cast<off_t>(length)) != 0)
+            throw std::system_error(errno, std::generic_category(), path);
+
+        int flags = MAP_SHARED;
+#ifdef MAP_POPULATE
+        // Fault the pages in now instead of on the hot path
+        flags |= MAP_POPULATE;
+#endif
+        void *mapping =
+            ::mmap(nullptr, length, PROT_READ | PROT_WRITE, flags, fd, 0);
+        if (mapping == MAP_FAILED)
+            throw std::system_error(errno, std::generic_category(), path);
+
+        auto *header = static_cast<journal::JournalHeader *>(mapping);
+        std::memcpy(header->magic, journal::MAGIC, sizeof(header->magic));
+        header->version = journal::VERSION;
+        header->recordSize = sizeof(journal::JournalRecord);
+        header->shardId = _shardId;
+        header->createdNs = createdNs;
+
+        _files.push_back(path);
+        file.path = std::move(path);
+        file.fd = fd;
+        file.mapping = mapping;
+        file.length = length;
+        return true;
+    } catch (const std::exception &e) {
+        if (fd >= 0) ::close(fd);
+        EKYC_LOG_ERROR("Shard {} journal disabled: {}", _shardId, e.what());
+        return false;
+    }
+}
+
+void RequestJournal::close_file(MappedFile &file,
+                                std::size_t records) noexcept {
+    if (!file.mapping) return;
+
+    ::munmap(file.mapping, file.length);
+    // Drop the unwritten tail of a file closed early
+    const std::size_t used = sizeof(journal::JournalHeader) +
+                             records * sizeof(journal::JournalRecord);
+    if (used < file.length) {
+        if (::ftruncate(file.fd, static_cast<off_t>(used)) != 0)
+            EKYC_LOG_ERROR("Shard {} journal truncate failed: {}", _shardId,
+                           std::strerror(errno));
+    }
+    ::close(file.fd);
+
+    file.fd = -1;
+    file.mapping = nullptr;
+    file.length = 0;
+}
+
+std::string RequestJournal::file_prefix() const {
+    return "shard" + std::to_string(_shardId) + "-";
+}
+
+void RequestJournal::adopt_existing_files(std::size_t keep) {
+    // Not created yet, so nothing to adopt
+    if (!std::filesystem::exists(_directory)) return;
+
+    const std::string prefix = file_prefix();
+    std::vector<std::pair<std::uint64_t, std::string>> found;
+    for (const auto &entry : std::filesystem::directory_iterator(_directory)) {
+        if (!entry.is_regular_file()) continue;
+        std::uint64_t createdNs;
+        if (parse_created_ns(entry.path().filename().string(), prefix,
+                             createdNs))
+            found.emplace_back(createdNs, entry.path().string());
+    }
+
+    std::sort(found.begin(), found.end());
+    for (auto &file : found) _files.push_back(std::move(file.second));
+    prune(keep);
+}
+
+void RequestJournal::prune(std::size_t keep) noexcept {
+    while (_files.size() > keep) {
+        std::error_code ec;
+        std::filesystem::remove(_files.front(), ec);
+        _files.pop_front();
+    }
+}
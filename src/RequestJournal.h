@@ -0,0 +1,97 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+
+#include "IdentityRequest.h"
+#include "JournalRecord.h"
+
+// Per-shard binary journal holding one JournalRecord per request, written
+// straight into a memory-mapped file. This takes the place of a dozen
+// formatted log lines per request with a single 256-byte copy; the
+// journal_decode tool renders it as text.
+//
+// Files are preallocated to fileSize and rotated when full, keeping the
+// newest maxFiles of the shard in the directory, including those left by
+// earlier runs. The first file is opened by the constructor; after that a
+// housekeeping thread creates and maps the next file ahead of time, and
+// closes and deletes old ones, so rotating is only a swap for the writer.
+// Appends come from a single thread: each shard owns one journal.
+class RequestJournal final {
+   public:
+    RequestJournal(std::string directory, std::uint32_t shardId,
+                   std::size_t fileSize, std::size_t maxFiles) noexcept;
+    ~RequestJournal() noexcept;
+
+    RequestJournal(const RequestJournal &) noexcept = delete;
+    RequestJournal &operator=(const RequestJournal &) noexcept = delete;
+    RequestJournal(RequestJournal &&) noexcept = delete;
+    RequestJournal &operator=(RequestJournal &&) noexcept = delete;
+
+    // A single identity request as decoded
+    void append(const IdentityRequest &request, journal::Outcome outcome,
+                journal::Source source) noexcept;
+    // One entry of a VerifyBatchRequest
+    void append(std::uint64_t batchId, std::string_view identityNumber,
+                std::string_view name, std::uint64_t receiveTimeNs,
+                journal::Outcome outcome, journal::Source source) noexcept;
+
+    std::uint64_t records() const noexcept { return _sequence; }
+
+   private:
+    struct MappedFile {
+        std::string path;
+        int fd = -1;
+        void *mapping = nullptr;
+        std::size_t length = 0;
+    };
+
+    // Slot for the next record, null if no file could be opened
+    journal::JournalRecord *next() noexcept;
+    // Swap in the prepared file and hand the full one to the housekeeper
+    void rotate() noexcept;
+    // Housekeeping thread
+    void prepare_files() noexcept;
+    // A new, mapped file with its header written, false if it failed
+    bool create_file(MappedFile &file) noexcept;
+    // Unmap and close, dropping the tail after records written records
+    void close_file(MappedFile &file, std::size_t records) noexcept;
+    // "shard<id>-", followed by the creation time and ".journal"
+    std::string file_prefix() const;
+    // Queue the files earlier runs of this shard left, oldest first, and
+    // delete all but the newest keep
+    void adopt_existing_files(std::size_t keep);
+    // Delete the oldest files until at most keep remain
+    void prune(std::size_t keep) noexcept;
+
+    const std::string _directory;
+    const std::uint32_t _shardId;
+    const std::size_t _capacity;
+    const std::size_t _maxFiles;
+
+    // Written to by the appending thread
+    MappedFile _current;
+    journal::JournalRecord *_records = nullptr;
+    std::size_t _index = 0;
+    std::uint64_t _sequence = 0;
+
+    // Handed between the appending thread and the housekeeper
+    std::mutex _mutex;
+    std::condition_variable _changed;
+    MappedFile _spare;
+    MappedFile _retired;
+    std::size_t _retiredRecords = 0;
+    bool _failed = false;
+    bool _stopping = false;
+
+    // Files of this shard in the directory, oldest first, housekeeper only
+    // once it runs
+    std::deque<std::string> _files;
+    std::thread _housekeeper;
+};
@@ -0,0 +1,223 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string_view>
+
+#include "IdentityRequest.h"
+#include "messages/CompactIdentityMessage.h"
+#include "messages/IdentityMessage.h"
+#include "messages/MessageHeader.h"
+#include "messages/VerifyBatchRequest.h"
+#include "messages/VerifyBatchResponse.h"
+
+// Encoding of identity responses. A response echoes the request with only
+// its result fields changed, so the request is copied wholesale instead of
+// round-tripping each field through std::string. Responses use the same
+// template as the request, except batches which are answered with a
+// VerifyBatchResponse.
+namespace response_encoder {
+
+constexpr std::string_view RESPONSE_MSG = "Identity Verification Response";
+
+constexpr std::size_t RESPONSE_LENGTH =
+    messages::MessageHeader::encodedLength() +
+    messages::IdentityMessage::sbeBlockLength();
+
+inline void encode_header(char *buffer, std::size_t length) {
+    messages::MessageHeader msgHeader;
+    msgHeader.wrap(buffer, 0, 0, length);
+    msgHeader.blockLength(messages::IdentityMessage::sbeBlockLength());
+    msgHeader.templateId(messages::IdentityMessage::sbeTemplateId());
+    msgHeader.schemaId(messages::IdentityMessage::sbeSchemaId());
+    msgHeader.version(messages::IdentityMessage::sbeSchemaVersion());
+}
+
+// Length of the version 1 block, the part a response echoes
+constexpr std::size_t ECHOED_LENGTH =
+    messages::IdentityMessage::kindEncodingOffset();
+
+// Both the v1 strings and the v2 enums, so either client version can read it
+inline void encode_result(messages::IdentityMessage &identity, bool verified) {
+    identity.msg().putCharVal(RESPONSE_MSG);
+    identity.verified().putCharVal(verified ? std::string_view("true")
+                                            : std::string_view("false"));
+    identity.kind(messages::MessageKind::VERIFICATION_RESPONSE);
+    identity.isVerified(verified ? messages::BooleanType::T
+                                 : messages::BooleanType::F);
+}
+
+// Echo the request's correlation id and timestamps, null for requests older
+// than version 5, and record the send time
+inline void encode_timing(messages::IdentityMessage &identity,
+                          const messages::IdentityMessage &request,
+                          std::uint64_t sendTimeNs) {
+    using messages::IdentityMessage;
+    // Without varData the encoded length is the sender's block length
+    if (carries_timing<IdentityMessage>(request.actingVersion(),
+                                        request.encodedLength())) {
+        identity.correlationId(request.correlationId());
+        identity.clientSendTimeNs(request.clientSendTimeNs());
+        identity.engineReceiveTimeNs(request.engineReceiveTimeNs());
+    } else {
+        identity.correlationId(IdentityMessage::correlationIdNullValue());
+        identity.clientSendTimeNs(IdentityMessage::clientSendTimeNsNullValue());
+        identity.engineReceiveTimeNs(
+            IdentityMessage::engineReceiveTimeNsNullValue());
+    }
+    identity.engineSendTimeNs(sendTimeNs);
+}
+
+// Fast path: one fixed-size copy of the request's string fields, then patch
+// the result. Requires the request to carry at least a version 1 block.
+inline void encode_block(char *buffer, std::size_t length,
+                         const messages::IdentityMessage &request,
+                         bool verified, std::uint64_t sendTimeNs) {
+    encode_header(buffer, length);
+
+    messages::IdentityMessage identity;
+    identity.wrapForEncode(buffer, messages::MessageHeader::encodedLength(),
+                           length);
+    // Constant size, so the compiler emits straight vector moves
+    std::memcpy(identity.buffer() + identity.offset(),
+                request.buffer() + request.offset(), ECHOED_LENGTH);
+
+    encode_result(identity, verified);
+    encode_timing(identity, request, sendTimeNs);
+}
+
+// Field by field copy, for requests whose block is too short to echo
+inline void encode_fields(char *buffer, std::size_t length,
+                          messages::IdentityMessage &request, bool verified,
+                          std::uint64_t sendTimeNs) {
+    encode_header(buffer, length);
+
+    messages::IdentityMessage identity;
+    identity.wrapForEncode(buffer, messages::MessageHeader::encodedLength(),
+                           length);
+
+    // Copy original data but update verification status and message
+    identity.type().putCharVal(request.type().getCharValAsStringView());
+    identity.id().putCharVal(request.id().getCharValAsStringView());
+    identity.name().putCharVal(request.name().getCharValAsStringView());
+    identity.dateOfIssue().putCharVal(
+        request.dateOfIssue().getCharValAsStringView());
+    identity.dateOfExpiry().putCharVal(
+        request.dateOfExpiry().getCharValAsStringView());
+    identity.address().putCharVal(request.address().getCharValAsStringView());
+    encode_result(identity, verified);
+    encode_timing(identity, request, sendTimeNs);
+}
+
+// The compact response is the request with kind, isVerified and, from
+// version 5, engineSendTimeNs patched, so it keeps the client's block length
+// and version
+inline void encode_compact(char *buffer, std::size_t length,
+                           const char *request, bool verified,
+                           std::uint64_t sendTimeNs) {
+    std::memcpy(buffer, request, length);
+
+    messages::MessageHeader msgHeader(buffer, length);
+    messages::CompactIdentityMessage identity;
+    identity.wrapForDecode(buffer, msgHeader.encodedLength(),
+                           msgHeader.blockLength(), msgHeader.version(),
+                           length);
+    identity.kind(messages::MessageKind::VERIFICATION_RESPONSE);
+    identity.isVerified(verified ? messages::BooleanType::T
+                                 : messages::BooleanType::F);
+    if (carries_timing<messages::CompactIdentityMessage>(
+            msgHeader.version(), msgHeader.blockLength()))
+        identity.engineSendTimeNs(sendTimeNs);
+}
+
+// One result per request entry, in request order
+inline void encode_batch(char *buffer, std::size_t length,
+                         messages::VerifyBatchRequest &request,
+                         const std::uint8_t *results, std::size_t count) {
+    // numInGroup is a uint16 with 65535 reserved
+    if (count > 65534)
+        throw std::runtime_error("too many results for one response");
+
+    messages::VerifyBatchResponse response;
+    response.wrapAndApplyHeader(buffer, 0, length);
+    response.batchId(request.batchId());
+
+    auto &group = response.resultsCount(static_cast<std::uint16_t>(count));
+    for (std::size_t i = 0; i < count; ++i) {
+        group.next().isVerified(results[i] != 0 ? messages::BooleanType::T
+                                                : messages::BooleanType::F);
+    }
+}
+
+// Bytes needed for the response to a request of requestLength bytes, which
+// must span exactly one message as recorded by IdentityRequest
+inline std::size_t response_length(const char *request,
+                                   std::size_t requestLength) {
+    // The decoders below only read through this pointer
+    char *start = const_cast<char *>(request);
+    messages::MessageHeader msgHeader(start, requestLength);
+
+    switch (msgHeader.templateId()) {
+        case messages::CompactIdentityMessage::sbeTemplateId():
+            return requestLength;
+        case messages::VerifyBatchRequest::sbeTemplateId(): {
+            messages::VerifyBatchRequest batch;
+            batch.wrapForDecode(start, msgHeader.encodedLength(),
+                                msgHeader.blockLength(), msgHeader.version(),
+                                requestLength);
+            using Results = messages::VerifyBatchResponse::Results;
+            return messages::VerifyBatchResponse::sbeBlockAndHeaderLength() +
+                   Results::sbeHeaderSize() +
+                   batch.entries().count() * Results::sbeBlockLength();
+        }
+        default:
+            return RESPONSE_LENGTH;
+    }
+}
+
+// Encode the response to request into buffer, which must hold
+// response_length() bytes. results holds one flag per identity the request
+// carries: a single one, or one per batch entry. sendTimeNs is stamped into
+// single responses. Throws if either buffer is too short.
+inline void encode(char *buffer, std::size_t length, const char *request,
+                   std::size_t requestLength, const std::uint8_t *results,
+                   std::size_t count, std::uint64_t sendTimeNs) {
+    // The decoders below only read through this pointer
+    char *start = const_cast<char *>(request);
+    messages::MessageHeader msgHeader(start, requestLength);
+
+    if (msgHeader.templateId() ==
+        messages::VerifyBatchRequest::sbeTemplateId()) {
+        messages::VerifyBatchRequest batch;
+        batch.wrapForDecode(start, msgHeader.encodedLength(),
+                            msgHeader.blockLength(), msgHeader.version(),
+                            requestLength);
+        encode_batch(buffer, length, batch, results, count);
+        return;
+    }
+
+    if (count != 1)
+        throw std::runtime_error("single request answered with many results");
+    const bool verified = results[0] != 0;
+
+    if (msgHeader.templateId() ==
+        messages::CompactIdentityMessage::sbeTemplateId()) {
+        if (length < requestLength)
+            throw std::runtime_error("buffer too short for response");
+        encode_compact(buffer, requestLength, request, verified, sendTimeNs);
+        return;
+    }
+
+    messages::IdentityMessage identity;
+    identity.wrapForDecode(start, msgHeader.encodedLength(),
+                           msgHeader.blockLength(), msgHeader.version(),
+                           requestLength);
+    if (identity.encodedLength() >= ECHOED_LENGTH)
+        encode_block(buffer, length, identity, verified, sendTimeNs);
+    else
+        encode_fields(buffer, length, identity, verified, sendTimeNs);
+}
+
+}  // namespace response_encoder
@@ -0,0 +1,189 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+// Lock-free single-producer / single-consumer ring of variable-length records.
+//
+// Every record is prefixed by an 8-byte header and padded to 8-byte alignment.
+// A record that would straddle the end of the buffer is preceded by a padding
+// record, so each payload is contiguous and can be handed to the consumer in
+// place without a second copy.
+class SPSCRingBuffer final {
+   public:
+    static constexpr std::size_t CACHE_LINE_SIZE = 64;
+    static constexpr std::size_t RECORD_ALIGNMENT = 8;
+    static constexpr std::size_t HEADER_LENGTH = 8;
+
+    explicit SPSCRingBuffer(std::size_t capacity)
+        : _capacity(round_up_pow2(capacity)),
+          _mask(_capacity - 1),
+          _buffer(new char[_capacity]) {
+        if (capacity < CACHE_LINE_SIZE)
+            throw std::invalid_argument(
+                "Ring buffer capacity " + std::to_string(capacity) +
+                " below the minimum of " + std::to_string(CACHE_LINE_SIZE));
+    }
+
+    ~SPSCRingBuffer() noexcept = default;
+
+    SPSCRingBuffer(const SPSCRingBuffer&) noexcept = delete;
+    SPSCRingBuffer& operator=(const SPSCRingBuffer&) noexcept = delete;
+    SPSCRingBuffer(SPSCRingBuffer&&) noexcept = delete;
+    SPSCRingBuffer& operator=(SPSCRingBuffer&&) noexcept = delete;
+
+    // Producer side: copy length bytes into the ring.
+    // Returns false if there is not enough free space.
+    bool try_write(const char* data, std::size_t length) noexcept {
+        return try_write(nullptr, 0, data, length);
+    }
+
+    // As above, with prefixLength bytes of prefix placed before data in the
+    // same record, so the consumer sees one contiguous payload
+    bool try_write(const char* prefix, std::size_t prefixLength,
+                   const char* data, std::size_t dataLength) noexcept {
+        char* payload = try_claim(prefixLength + dataLength);
+        if (!payload) return false;
+
+        if (prefixLength != 0) std::memcpy(payload, prefix, prefixLength);
+        std::memcpy(payload + prefixLength, data, dataLength);
+        commit();
+        return true;
+    }
+
+    // Producer side: reserve a record of length bytes to be written in place,
+    // or null if there is not enough free space. The consumer sees it only
+    // after commit(); a claim that is never committed is discarded by the
+    // next one.
+    char* try_claim(std::size_t length) noexcept {
+        const std::size_t recordLength = align(HEADER_LENGTH + length);
+        // Larger records could need more than the whole ring once padded
+        if (recordLength > max_record_length()) return nullptr;
+
+        const std::uint64_t tail = _tail.load(std::memory_order_relaxed);
+        std::size_t index = tail & _mask;
+        const std::size_t toEnd = _capacity - index;
+        const std::size_t padding = recordLength > toEnd ? toEnd : 0;
+        const std::size_t required = recordLength + padding;
+
+        if (required > _capacity - (tail - _headCache)) {
+            _headCache = _head.load(std::memory_order_acquire);
+            if (required > _capacity - (tail - _headCache)) return nullptr;
+        }
+
+        if (padding != 0) {
+            put_header(index, padding - HEADER_LENGTH, RecordType::PADDING);
+            index = 0;
+        }
+
+        put_header(index, length, RecordType::DATA);
+        _claimed = required;
+        return _buffer.get() + index + HEADER_LENGTH;
+    }
+
+    // Producer side: publish the record returned by the last try_claim()
+    void commit() noexcept {
+        const std::uint64_t tail = _tail.load(std::memory_order_relaxed);
+        _tail.store(tail + _claimed, std::memory_order_release);
+        _claimed = 0;
+    }
+
+    // Consumer side: invoke handler(char* data, std::size_t length) for up to
+    // limit records. Space is released to the producer once handler returns.
+    template <typename Handler>
+    std::size_t read(Handler&& handler, std::size_t limit) noexcept {
+        return read_while(
+            [&handler](char* data, std::size_t length) {
+                handler(data, length);
+                return true;
+            },
+            limit);
+    }
+
+    // As read(), but handler returns bool and the first record it returns
+    // false for is left in the ring, to be handed over again by the next read
+    template <typename Handler>
+    std::size_t read_while(Handler&& handler, std::size_t limit) noexcept {
+        const std::uint64_t head = _head.load(std::memory_order_relaxed);
+        const std::uint64_t tail = _tail.load(std::memory_order_acquire);
+
+        std::size_t count = 0;
+        std::uint64_t position = head;
+        while (position < tail && count < limit) {
+            const std::size_t index = position & _mask;
+            Header header;
+            std::memcpy(&header, _buffer.get() + index, HEADER_LENGTH);
+            const std::size_t recordLength =
+                align(HEADER_LENGTH + header.length);
+
+            if (header.type == RecordType::PADDING) {
+                position += recordLength;
+                continue;
+            }
+
+            if (!handler(_buffer.get() + index + HEADER_LENGTH,
+                         static_cast<std::size_t>(header.length)))
+                break;
+            position += recordLength;
+            ++count;
+        }
+
+        if (position != head) _head.store(position, std::memory_order_release);
+        return count;
+    }
+
+    // Approximate number of bytes in use, safe to call from any thread
+    std::size_t size() const noexcept {
+        const std::uint64_t head = _head.load(std::memory_order_acquire);
+        const std::uint64_t tail = _tail.load(std::memory_order_acquire);
+        return static_cast<std::size_t>(tail - head);
+    }
+
+    bool empty() const noexcept { return size() == 0; }
+
+    std::size_t capacity() const noexcept { return _capacity; }
+
+    std::size_t max_record_length() const noexcept { return _capacity / 2; }
+
+   private:
+    enum class RecordType : std::uint32_t { DATA, PADDING };
+
+    struct Header {
+        std::uint32_t length;
+        RecordType type;
+    };
+    static_assert(sizeof(Header) == HEADER_LENGTH, "Unexpected header size");
+
+    static constexpr std::size_t align(std::size_t length) noexcept {
+        return (length + RECORD_ALIGNMENT - 1) & ~(RECORD_ALIGNMENT - 1);
+    }
+
+    static std::size_t round_up_pow2(std::size_t value) noexcept {
+        std::size_t result = CACHE_LINE_SIZE;
+        while (result < value) result <<= 1;
+        return result;
+    }
+
+    void put_header(std::size_t index, std::size_t length,
+                    RecordType type) noexcept {
+        Header header{static_cast<std::uint32_t>(length), type};
+        std::memcpy(_buffer.get() + index, &header, HEADER_LENGTH);
+    }
+
+    const std::size_t _capacity;
+    const std::size_t _mask;
+    std::unique_ptr<char[]> _buffer;
+
+    // Consumer-owned
+    alignas(CACHE_LINE_SIZE) std::atomic<std::uint64_t> _head{0};
+    // Producer-owned
+    alignas(CACHE_LINE_SIZE) std::atomic<std::uint64_t> _tail{0};
+    std::uint64_t _headCache{0};
+    // Bytes reserved by the last try_claim(), padding included
+    std::size_t _claimed{0};
+};
@@ -0,0 +1,355 @@
+#include "Shard.h"
+
+#include <algorithm>
+#include <cstring>
+#include <exception>
+#include <limits>
+#include <string_view>
+
+#include "AllocationCheck.h"
+#include "Config.h"
+#include "IdentityRequest.h"
+#include "Log.h"
+#include "helper.h"
+#include "messages/MessageHeader.h"
+#include "messages/VerifyBatchRequest.h"
+
+namespace {
+
+std::unique_ptr<SPSCRingBuffer> make_outbound_queue(std::size_t size) {
+    if (size == 0) return nullptr;
+    return std::make_unique<SPSCRingBuffer>(
+        std::max(size, SPSCRingBuffer::CACHE_LINE_SIZE));
+}
+
+// The publication is up but momentarily full, worth another try
+bool is_back_pressure(SendResult result) noexcept {
+    return result == SendResult::BACK_PRESSURED ||
+           result == SendResult::ADMIN_ACTION;
+}
+
+}  // namespace
+
+Shard::Shard(std::uint32_t shardId, std::uint32_t numShards,
+             std::size_t ringBufferSize,
+             std::unique_ptr<ResponsePublisher> publisher,
+             CounterSet counters)
+    : _shardId(shardId),
+      _ringBuffer(ringBufferSize),
+      _publisher(std::move(publisher)),
+      _outbound(make_outbound_queue(Config::get().OUTBOUND_QUEUE_SIZE)),
+      _publishIdleStrategy(
+          IdleStrategy::create(Config::get().PUBLISH_IDLE_STRATEGY)),
+      _publishRetryTimeout(std::chrono::microseconds(
+          std::max<std::int64_t>(Config::get().PUBLISH_RETRY_TIMEOUT_US, 0))),
+      _running(false),
+      _idleStrategy(IdleStrategy::create(Config::get().WORKER_IDLE_STRATEGY)),
+      _requestProcessed(0),
+      _counters(counters),
+      _timedStages(Config::get().LATENCY_STATS_ENABLED ? &_latencies
+                                                       : nullptr),
+      _requestHandler(shardId, numShards, _timedStages, _counters,
+                      [this](const char *request, std::size_t length,
+                             const std::uint8_t *results,
+                             std::size_t resultCount) {
+                          send_response(request, length, results,
+                                        resultCount);
+                      }),
+      _drainTimeout(std::chrono::milliseconds(
+          std::max(Config::get().VERIFY_GROUP_DRAIN_TIMEOUT_MS, 0))) {}
+
+Shard::~Shard() noexcept { stop(); }
+
+void Shard::start() noexcept {
+    if (_running.exchange(true)) return;
+
+    _worker = std::thread([this]() { run(); });
+    EKYC_LOG_INFO("Shard {} started", _shardId);
+}
+
+void Shard::stop() noexcept {
+    if (!_running.exchange(false)) return;
+
+    if (_worker.joinable()) _worker.join();
+    EKYC_LOG_INFO("Shard {} stopped after {} requests", _shardId,
+                  _requestProcessed);
+}
+
+void Shard::set_peers(std::vector<Shard *> peers) {
+    _owners.assign(peers.size(), 0);
+    _peers = std::move(peers);
+}
+
+bool Shard::offer(const char *buffer, std::size_t length,
+                  std::uint64_t receiveTimeNs,
+                  std::uint64_t sequence) noexcept {
+    const RecordPrefix prefix{receiveTimeNs, sequence};
+    return _ringBuffer.try_write(reinterpret_cast<const char *>(&prefix),
+                                 PREFIX_LENGTH, buffer, length);
+}
+
+void Shard::run() noexcept {
+    // Also sets up this thread's logger queue before the first request, so
+    // it bypasses the level checks
+    qLogger::get().info_fast("Shard {} worker running", _shardId);
+
+    auto handler = [this](char *buffer, std::size_t length) {
+        process(buffer, length);
+    };
+
+    while (_running.load(std::memory_order_acquire)) {
+        std::size_t workCount = drain_outbound();
+        workCount += serve_drain();
+        workCount += _ringBuffer.read(handler, FRAGMENT_LIMIT);
+        _counters.set(counters::QUEUE_DEPTH, _ringBuffer.size());
+        workCount += _requestHandler.poll();
+        _idleStrategy->idle(static_cast<int>(workCount));
+    }
+
+    // Drain whatever the poller queued before it was stopped
+    while (_ringBuffer.read(handler, FRAGMENT_LIMIT) != 0) {
+    }
+    _requestHandler.flush();
+    // Nothing else arrives, so peers waiting on this shard can go ahead
+    _drainedThrough.store(std::numeric_limits<std::uint64_t>::max(),
+                          std::memory_order_release);
+    _counters.set(counters::QUEUE_DEPTH, 0);
+    if (!_outbound) return;
+
+    // Give queued responses a bounded chance to go out, then count the rest
+    const auto deadline =
+        std::chrono::steady_clock::now() +
+        std::chrono::milliseconds(Config::get().SHARD_TIMEOUT_MS);
+    while (!_outbound->empty() && std::chrono::steady_clock::now() < deadline)
+        _publishIdleStrategy->idle(static_cast<int>(drain_outbound()));
+    const std::size_t lost =
+        _outbound->read([](char *, std::size_t) {},
+                        std::numeric_limits<std::size_t>::max());
+    _counters.set(counters::OUTBOUND_DEPTH, 0);
+    if (lost == 0) return;
+    _counters.add(counters::RESPONSES_DROPPED, lost);
+    EKYC_LOG_ERROR("Shard {} dropped {} queued responses on shutdown",
+                   _shardId, lost);
+}
+
+void Shard::process(char *buffer, std::size_t length) noexcept {
+    ++_requestProcessed;
+    try {
+        RecordPrefix prefix;
+        std::memcpy(&prefix, buffer, PREFIX_LENGTH);
+        char *request = buffer + PREFIX_LENGTH;
+        const std::size_t requestLength = length - PREFIX_LENGTH;
+        if (!_peers.empty())
+            drain_owners(request, requestLength, prefix.sequence);
+        _requestHandler.respond(request, requestLength, prefix.receiveTimeNs);
+    } catch (const std::exception &e) {
+        EKYC_LOG_ERROR("Shard {} error: {}", _shardId, e.what());
+    }
+}
+
+void Shard::request_drain(std::uint64_t sequence) noexcept {
+    std::uint64_t requested = _drainRequested.load(std::memory_order_relaxed);
+    while (requested < sequence &&
+           !_drainRequested.compare_exchange_weak(requested, sequence,
+                                                  std::memory_order_release,
+                                                  std::memory_order_relaxed)) {
+    }
+}
+
+bool Shard::drained(std::uint64_t sequence) const noexcept {
+    return _drainedThrough.load(std::memory_order_acquire) >= sequence;
+}
+
+std::size_t Shard::serve_drain() noexcept {
+    const std::uint64_t requested =
+        _drainRequested.load(std::memory_order_acquire);
+    if (requested <= _drainedThrough.load(std::memory_order_relaxed)) return 0;
+
+    // The peer read its batch after the poller offered this ring everything
+    // sequenced before it, so all of that is visible here by now
+    std::size_t workCount = _ringBuffer.read_while(
+        [this, requested](char *buffer, std::size_t length) {
+            RecordPrefix prefix;
+            std::memcpy(&prefix, buffer, PREFIX_LENGTH);
+            if (prefix.sequence >= requested) return false;
+            process(buffer, length);
+            return true;
+        },
+        std::numeric_limits<std::size_t>::max());
+    workCount += _requestHandler.flush();
+    _drainedThrough.store(requested, std::memory_order_release);
+    return workCount;
+}
+
+void Shard::serve_drain_at(std::uint64_t sequence) noexcept {
+    // Records before this one are processed, it and later ones are not. A
+    // request beyond it may hide a lower one, which is served regardless.
+    const std::uint64_t through = std::min(
+        _drainRequested.load(std::memory_order_acquire), sequence);
+    if (through <= _drainedThrough.load(std::memory_order_relaxed)) return;
+
+    _requestHandler.flush();
+    _drainedThrough.store(through, std::memory_order_release);
+}
+
+// Batches waiting on each other's shards cannot deadlock: the one with the
+// lowest sequence needs nothing the others have not processed yet, so they
+// serve it while waiting
+void Shard::drain_owners(char *request, std::size_t length,
+                         std::uint64_t sequence) noexcept {
+    std::size_t owners = 0;
+    try {
+        messages::MessageHeader msgHeader(request, length);
+        if (msgHeader.templateId() !=
+            messages::VerifyBatchRequest::sbeTemplateId())
+            return;
+
+        messages::VerifyBatchRequest batch;
+        batch.wrapForDecode(request, msgHeader.encodedLength(),
+                            msgHeader.blockLength(), msgHeader.version(),
+                            length);
+        std::fill(_owners.begin(), _owners.end(), 0);
+        auto &entries = batch.entries();
+        const std::uint64_t count = entries.count();
+        for (std::uint64_t i = 0; i < count; ++i) {
+            entries.next();
+            const std::string_view identityNumber = entries.getIdAsStringView();
+            entries.skipName();
+            const std::size_t owner = shard_for_identity(
+                identityNumber.data(), identityNumber.size(), _peers.size());
+            if (owner == _shardId || _owners[owner]) continue;
+            // Ask them all before waiting, so they drain in parallel
+            _owners[owner] = 1;
+            _peers[owner]->request_drain(sequence);
+            ++owners;
+        }
+    } catch (const std::exception &) {
+        // Malformed, left to RequestHandler to report
+        return;
+    }
+    if (owners == 0) return;
+
+    const auto deadline = std::chrono::steady_clock::now() + _drainTimeout;
+    for (std::size_t owner = 0; owner < _peers.size(); ++owner) {
+        if (!_owners[owner]) continue;
+        while (!_peers[owner]->drained(sequence)) {
+            serve_drain_at(sequence);
+            if (std::chrono::steady_clock::now() >= deadline) {
+                EKYC_LOG_ERROR(
+                    "Shard {} answering batch without shard {}, which did "
+                    "not drain within VERIFY_GROUP_DRAIN_TIMEOUT_MS",
+                    _shardId, owner);
+                return;
+            }
+            std::this_thread::yield();
+        }
+    }
+}
+
+// Encode in place in the transport's buffer, no intermediate copy. While
+// responses are queued, newer ones queue behind them so each client still
+// sees its responses in order.
+void Shard::send_response(const char *request, std::size_t requestLength,
+                          const std::uint8_t *results,
+                          std::size_t resultCount) noexcept {
+    if (!_publisher) return;
+
+    const std::size_t length =
+        RequestHandler::response_length(request, requestLength);
+    if (length == 0) return;
+
+    char *buffer = nullptr;
+    // Behind queued responses counts as back pressure
+    SendResult result = SendResult::BACK_PRESSURED;
+    if (!_outbound || _outbound->empty()) {
+        StageTimer publishTimer(_timedStages, Stage::PUBLISH);
+        result = claim_with_retry(length, buffer);
+        publishTimer.stop();
+    }
+
+    const bool queued = result != SendResult::SUCCESS;
+    if (queued) {
+        if (!_outbound || !is_back_pressure(result)) {
+            drop_response(send_result_name(result));
+            return;
+        }
+        buffer = _outbound->try_claim(length);
+        if (!buffer) {
+            drop_response("outbound queue full");
+            return;
+        }
+    }
+
+    StageTimer encodeTimer(_timedStages, Stage::ENCODE);
+    if (!RequestHandler::encode_response(buffer, length, request,
+                                         requestLength, results, resultCount,
+                                         epoch_nanos())) {
+        encodeTimer.cancel();
+        // An uncommitted queue claim is simply reused by the next one
+        if (!queued) _publisher->abort();
+        return;
+    }
+    encodeTimer.stop();
+
+    if (!queued) {
+        _publisher->commit();
+        return;
+    }
+    _outbound->commit();
+    _counters.increment(counters::RESPONSES_QUEUED);
+    _counters.set(counters::OUTBOUND_DEPTH, _outbound->size());
+}
+
+SendResult Shard::claim_with_retry(std::size_t length,
+                                   char *&buffer) noexcept {
+    SendResult result = _publisher->try_claim(length, buffer);
+    if (!is_back_pressure(result)) return result;
+
+    _counters.increment(counters::BACK_PRESSURE);
+    if (_publishRetryTimeout.count() == 0) return result;
+
+    const auto deadline =
+        std::chrono::steady_clock::now() + _publishRetryTimeout;
+    _publishIdleStrategy->reset();
+    do {
+        _publishIdleStrategy->idle();
+        _counters.increment(counters::PUBLISH_RETRIES);
+        result = _publisher->try_claim(length, buffer);
+    } while (is_back_pressure(result) &&
+             std::chrono::steady_clock::now() < deadline);
+    return result;
+}
+
+std::size_t Shard::drain_outbound() noexcept {
+    if (!_outbound || _outbound->empty()) return 0;
+
+    const std::size_t handled = _outbound->read_while(
+        [this](char *response, std::size_t length) {
+            char *buffer = nullptr;
+            const SendResult result = _publisher->try_claim(length, buffer);
+            if (is_back_pressure(result)) return false;
+            // e.g. not connected: waiting would wedge every later response
+            if (result != SendResult::SUCCESS) {
+                drop_response(send_result_name(result));
+                return true;
+            }
+            std::memcpy(buffer, response, length);
+            // Encoded when it was queued, so the send time is now
+            try {
+                stamp_send_time(buffer, length, epoch_nanos());
+            } catch (const std::exception &e) {
+                EKYC_LOG_ERROR("Error stamping queued response: {}", e.what());
+            }
+            _publisher->commit();
+            return true;
+        },
+        FRAGMENT_LIMIT);
+    _counters.set(counters::OUTBOUND_DEPTH, _outbound->size());
+    return handled;
+}
+
+void Shard::drop_response(const char *reason) noexcept {
+    _counters.increment(counters::RESPONSES_DROPPED);
+    AllocationCheck::allow();
+    EKYC_LOG_ERROR("Shard {} dropped response: {}", _shardId, reason);
+}
@@ -0,0 +1,135 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "CountersFile.h"
+#include "IdleStrategy.h"
+#include "LatencyHistogram.h"
+#include "RequestHandler.h"
+#include "SPSCRingBuffer.h"
+#include "Transport.h"
+
+// A shard owns one SPSC ring fed by the poller thread, plus the worker thread,
+// RequestHandler and database connection that drain it and the publisher its
+// responses go out on. Responses the publisher refuses for longer than
+// PUBLISH_RETRY_TIMEOUT_US wait in the shard's outbound queue, which the
+// worker drains every duty cycle ahead of new requests.
+//
+// A VerifyBatchRequest is routed by its batchId, so entries can belong to
+// other shards. Before it is answered, each of those owners answers every
+// request the poller gave it earlier, pending batches included.
+class Shard final {
+   public:
+    // Throws if ringBufferSize is below SPSCRingBuffer's minimum
+    Shard(std::uint32_t shardId, std::uint32_t numShards,
+          std::size_t ringBufferSize,
+          std::unique_ptr<ResponsePublisher> publisher,
+          CounterSet counters);
+
+    ~Shard() noexcept;
+
+    Shard(const Shard &) noexcept = delete;
+    Shard &operator=(const Shard &) noexcept = delete;
+    Shard(Shard &&) noexcept = delete;
+    Shard &operator=(Shard &&) noexcept = delete;
+
+    void start() noexcept;
+
+    void stop() noexcept;
+
+    // The engine's shards, indexed by shard id, for VerifyBatchRequest
+    // ordering; set before start()
+    void set_peers(std::vector<Shard *> peers);
+
+    // Copy a fragment into the ring along with the time it was received and
+    // its place in the poller's arrival order, called from the poller thread
+    // only
+    bool offer(const char *buffer, std::size_t length,
+               std::uint64_t receiveTimeNs, std::uint64_t sequence) noexcept;
+
+    std::uint32_t id() const noexcept { return _shardId; }
+
+    // Written by the worker, safe to read from any thread
+    const StageLatencies &latencies() const noexcept { return _latencies; }
+
+    std::size_t queue_depth() const noexcept { return _ringBuffer.size(); }
+
+    std::size_t max_fragment_length() const noexcept {
+        return _ringBuffer.max_record_length() - SPSCRingBuffer::HEADER_LENGTH -
+               PREFIX_LENGTH;
+    }
+
+   private:
+    // Written ahead of each fragment in the ring
+    struct RecordPrefix {
+        std::uint64_t receiveTimeNs;
+        std::uint64_t sequence;
+    };
+
+    void run() noexcept;
+    void process(char *buffer, std::size_t length) noexcept;
+    // Ask this shard, from a peer's worker, to answer everything offered to
+    // it before sequence; drained() turns true once it has
+    void request_drain(std::uint64_t sequence) noexcept;
+    bool drained(std::uint64_t sequence) const noexcept;
+    // Serve a pending request_drain(), reading the ring up to the requested
+    // sequence
+    std::size_t serve_drain() noexcept;
+    // As serve_drain() while processing the record at sequence, so without
+    // reading further: drains through sequence at most
+    void serve_drain_at(std::uint64_t sequence) noexcept;
+    // Drain the other shards owning entries of the VerifyBatchRequest at
+    // sequence, no-op for other templates
+    void drain_owners(char *request, std::size_t length,
+                      std::uint64_t sequence) noexcept;
+    void send_response(const char *request, std::size_t length,
+                       const std::uint8_t *results,
+                       std::size_t resultCount) noexcept;
+    // Retries back pressure with the publish idle strategy until the timeout
+    SendResult claim_with_retry(std::size_t length, char *&buffer) noexcept;
+    // Sends queued responses in order until back pressure stops them; one
+    // the publisher refuses for any other reason is dropped
+    std::size_t drain_outbound() noexcept;
+    void drop_response(const char *reason) noexcept;
+
+    static constexpr std::size_t FRAGMENT_LIMIT = 16;
+    static constexpr std::size_t PREFIX_LENGTH = sizeof(RecordPrefix);
+
+    const std::uint32_t _shardId;
+    SPSCRingBuffer _ringBuffer;
+    std::unique_ptr<ResponsePublisher> _publisher;
+    // Encoded responses that outlasted the retries, null with
+    // OUTBOUND_QUEUE_SIZE 0; written and read by the worker only
+    std::unique_ptr<SPSCRingBuffer> _outbound;
+    std::unique_ptr<IdleStrategy> _publishIdleStrategy;
+    const std::chrono::nanoseconds _publishRetryTimeout;
+
+    std::atomic<bool> _running;
+    std::thread _worker;
+    std::unique_ptr<IdleStrategy> _idleStrategy;
+    std::uint64_t _requestProcessed;
+    // This shard's block in the counters file, written by the worker only
+    CounterSet _counters;
+
+    // Per-stage timings of this worker, read by the engine's reporter
+    StageLatencies _latencies;
+    // &_latencies, null with LATENCY_STATS_ENABLED off
+    StageLatencies *const _timedStages;
+
+    RequestHandler _requestHandler;
+
+    // Empty with a single shard
+    std::vector<Shard *> _peers;
+    // Per peer, whether the batch being ordered has an entry it owns
+    std::vector<std::uint8_t> _owners;
+    // Highest sequence a peer asked to be drained through, and the highest
+    // this worker has, the maximum once it has stopped
+    std::atomic<std::uint64_t> _drainRequested{0};
+    std::atomic<std::uint64_t> _drainedThrough{0};
+    const std::chrono::milliseconds _drainTimeout;
+};
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+// How requests reach the engine and responses leave it. AeronTransport is
+// the production one; LoopbackTransport keeps both directions in process
+// memory so benchmarks can drive the whole pipeline without a media driver.
+
+enum class SendResult {
+    SUCCESS,
+    NOT_CONNECTED,
+    BACK_PRESSURED,
+    ADMIN_ACTION,
+    CLOSED,
+    MAX_POSITION_EXCEEDED,
+    ERROR,
+};
+
+inline const char *send_result_name(SendResult result) noexcept {
+    switch (result) {
+        case SendResult::SUCCESS:
+            return "SUCCESS";
+        case SendResult::NOT_CONNECTED:
+            return "NOT_CONNECTED";
+        case SendResult::BACK_PRESSURED:
+            return "BACK_PRESSURED";
+        case SendResult::ADMIN_ACTION:
+            return "ADMIN_ACTION";
+        case SendResult::CLOSED:
+            return "CLOSED";
+        case SendResult::MAX_POSITION_EXCEEDED:
+            return "MAX_POSITION_EXCEEDED";
+        default:
+            return "ERROR";
+    }
+}
+
+// The outbound side of one shard, used by its worker thread only. Responses
+// are encoded in place: claim, write, then commit or abort before the next
+// claim.
+class ResponsePublisher {
+   public:
+    virtual ~ResponsePublisher() noexcept = default;
+
+    // Reserve length bytes and point buffer at them
+    virtual SendResult try_claim(std::size_t length, char *&buffer) = 0;
+    virtual void commit() noexcept = 0;
+    // Drop the claim, subscribers never see it
+    virtual void abort() noexcept = 0;
+};
+
+class Transport {
+   public:
+    // One inbound fragment, only valid for the duration of the call
+    using FragmentHandler = std::function<void(char *, std::size_t)>;
+
+    virtual ~Transport() noexcept = default;
+
+    virtual const char *name() const noexcept = 0;
+
+    // Hand up to fragmentLimit inbound fragments to handler, from a single
+    // thread. Returns how many were read.
+    virtual int poll(const FragmentHandler &handler, int fragmentLimit) = 0;
+
+    // The publisher for shardId's worker, created before the shards start
+    virtual std::unique_ptr<ResponsePublisher> publisher(
+        std::uint32_t shardId) = 0;
+};
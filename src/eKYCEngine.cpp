@@ -1,30 +1,74 @@
 #include "eKYCEngine.h"
 
+#include <algorithm>
+#include <chrono>
 #include <exception>
+#include <thread>
 
+#include "AeronTransport.h"
 #include "Config.h"
-#include "loggerlib.h"
+#include "IdentityRequest.h"
+#include "Log.h"
+#include "helper.h"
+
+namespace {
+
+// Null if the media driver cannot be reached, the engine then never starts
+std::unique_ptr<Transport> create_aeron_transport() noexcept {
+    try {
+        return std::make_unique<AeronTransport>();
+    } catch (const std::exception &e) {
+        EKYC_LOG_ERROR("Error: {}", e.what());
+        return nullptr;
+    }
+}
+
+}  // namespace
+
+eKYCEngine::eKYCEngine() noexcept : eKYCEngine(create_aeron_transport()) {}
+
+eKYCEngine::eKYCEngine(std::unique_ptr<Transport> transport) noexcept
+    : _transport(std::move(transport)),
+      _running(false),
+      _countersFile(Config::get().COUNTERS_FILE,
+                    std::max(Config::get().NUM_SHARDS, 1)),
+      _counters(_countersFile.global()) {
+    if (!_transport) return;
 
-eKYCEngine::eKYCEngine() noexcept
-    : _running(false), _requestReceived(0), _requestHandler() {
     try {
         auto &cfg = Config::get();
-        _aeron = std::make_unique<aeron_wrapper::Aeron>(cfg.AERON_DIR);
-        qLogger::get().info_fast("Connected to Aeron Media Driver...");
-        std::string subscriptionChannel =
-            "aeron:" + cfg.AERON_PROTOCOL + "?endpoint=" + cfg.SUBSCRIPTION_IP +
-            ":" + std::to_string(cfg.SUBSCRIPTION_PORT);
-        _subscription = _aeron->create_subscription(subscriptionChannel,  //
-                                                    cfg.SUBSCRIPTION_STREAM_ID);
-        std::string publicationChannel =
-            "aeron:" + cfg.AERON_PROTOCOL + "?endpoint=" + cfg.PUBLICATION_IP +
-            ":" + std::to_string(cfg.PUBLICATION_PORT);
-        _publication = _aeron->create_publication(publicationChannel,  //
-                                                  cfg.PUBLICATION_STREAM_ID);
+        EKYC_LOG_INFO("Transport: {}", _transport->name());
+
+        const int numShards = std::max(cfg.NUM_SHARDS, 1);
+        _shards.reserve(numShards);
+        for (int i = 0; i < numShards; ++i) {
+            _shards.push_back(std::make_unique<Shard>(
+                i, numShards, cfg.MAX_RING_BUFFER_SIZE,
+                _transport->publisher(i), _countersFile.shard(i)));
+        }
+        if (numShards > 1) {
+            std::vector<Shard *> peers;
+            for (auto &shard : _shards) peers.push_back(shard.get());
+            for (auto &shard : _shards) shard->set_peers(peers);
+        }
+        EKYC_LOG_INFO("Created {} shards with {} byte rings", numShards,
+                      cfg.MAX_RING_BUFFER_SIZE);
+
+        if (cfg.LATENCY_STATS_ENABLED) {
+            _latencyReporter = std::make_unique<LatencyReporter>(
+                std::chrono::milliseconds(cfg.LATENCY_REPORT_INTERVAL_MS),
+                cfg.LATENCY_REPORT_FILE);
+            for (auto &shard : _shards)
+                _latencyReporter->add(&shard->latencies());
+        }
+
+        _pollerIdleStrategy = IdleStrategy::create(cfg.POLLER_IDLE_STRATEGY);
+        EKYC_LOG_INFO("Poller idle strategy: {}", _pollerIdleStrategy->name());
 
         _running = true;
     } catch (const std::exception &e) {
-        qLogger::get().info_fast("Error: {}", e.what());
+        // e.g. MAX_RING_BUFFER_SIZE too small; start() is then a no-op
+        EKYC_LOG_ERROR("Engine setup failed, not starting: {}", e.what());
     }
 }
 
@@ -33,47 +77,84 @@ eKYCEngine::~eKYCEngine() noexcept { stop(); }
 void eKYCEngine::start() noexcept {
     if (!_running) return;
 
-    qLogger::get().info_fast("Starting eKYC engine...");
+    EKYC_LOG_INFO("Starting eKYC engine...");
+    // Workers first so the poller never routes into a stopped shard
+    for (auto &shard : _shards) shard->start();
+
     // Start background msg processing
-    _backgroundPoller = _subscription->start_background_polling(
-        [this](const aeron_wrapper::FragmentData &fragmentData) {
-            receive_request(fragmentData);
-        });
+    _poller = std::thread([this]() { poll(); });
 }
 
 void eKYCEngine::stop() noexcept {
-    if (!_running) return;
+    if (!_running.exchange(false)) return;
 
-    if (_backgroundPoller) {
-        _backgroundPoller->stop();
-    }
+    if (_poller.joinable()) _poller.join();
+    // Shards drain their rings before joining
+    for (auto &shard : _shards) shard->stop();
 
-    _running = false;
-    qLogger::get().info_fast("eKYC engine stopped.");
+    if (_latencyReporter) _latencyReporter->report(true);
+    EKYC_LOG_INFO("eKYC engine stopped.");
 }
 
-void eKYCEngine::receive_request(
-    const aeron_wrapper::FragmentData &fragmentData) noexcept {
-    ++_requestReceived;
-    try {
-        auto buffer = _requestHandler.respond(fragmentData);
-        send_response(buffer);
-    } catch (const std::exception &e) {
-        qLogger::get().error_fast("Error: {}", e.what());
+void eKYCEngine::report_latency() noexcept {
+    if (_latencyReporter) _latencyReporter->poll();
+}
+
+void eKYCEngine::poll() noexcept {
+    const Transport::FragmentHandler handler =
+        [this](char *buffer, std::size_t length) {
+            receive_request(buffer, length);
+        };
+
+    while (_running.load(std::memory_order_acquire)) {
+        int fragmentsRead = 0;
+        try {
+            fragmentsRead = _transport->poll(handler, FRAGMENT_LIMIT);
+        } catch (const std::exception &e) {
+            EKYC_LOG_ERROR("Poll error: {}", e.what());
+        }
+        _pollerIdleStrategy->idle(fragmentsRead);
     }
 }
 
-void eKYCEngine::send_response(std::vector<char> &buffer) noexcept {
-    if (!_publication) return;
+void eKYCEngine::receive_request(char *buffer, std::size_t length) noexcept {
+    // Taken first, so the breakdown includes routing and ring hand-off
+    const std::uint64_t receiveTimeNs = epoch_nanos();
+    const std::uint64_t sequence = ++_sequence;
+    _counters.increment(counters::RECEIVED);
+    try {
+        auto &shard = *_shards[shard_index(buffer, length)];
+        if (shard.offer(buffer, length, receiveTimeNs, sequence)) return;
 
-    if (buffer.empty()) return;
+        if (length > shard.max_fragment_length()) {
+            _counters.increment(counters::DROPPED);
+            EKYC_LOG_ERROR("Fragment of {} bytes exceeds shard ring", length);
+            return;
+        }
 
-    auto result = _publication->offer(
-        reinterpret_cast<const uint8_t *>(buffer.data()), buffer.size());
-    if (result == aeron_wrapper::PublicationResult::SUCCESS) {
-        qLogger::get().info_fast("Response sent successfully");
-    } else {
-        qLogger::get().error_fast("Failed to send response: {}",
-                                  pubresult_to_string(result));
+        // Ring full: wait for the worker to catch up, bounded by the timeout
+        auto deadline =
+            std::chrono::steady_clock::now() +
+            std::chrono::milliseconds(Config::get().SHARD_TIMEOUT_MS);
+        while (!shard.offer(buffer, length, receiveTimeNs, sequence)) {
+            if (std::chrono::steady_clock::now() >= deadline) {
+                _counters.increment(counters::DROPPED);
+                EKYC_LOG_ERROR(
+                    "Shard {} full, dropped request ({} dropped so far)",
+                    shard.id(), _counters.get(counters::DROPPED));
+                return;
+            }
+            std::this_thread::yield();
+        }
+    } catch (const std::exception &e) {
+        EKYC_LOG_ERROR("Error: {}", e.what());
     }
 }
+
+// Route by identity number so requests for one identity stay in order
+std::size_t eKYCEngine::shard_index(char *buffer, std::uint64_t length) const {
+    if (_shards.size() == 1) return 0;
+
+    const std::string_view key = routing_key(buffer, length);
+    return shard_for_identity(key.data(), key.size(), _shards.size());
+}
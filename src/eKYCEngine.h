@@ -1,37 +1,62 @@
 #pragma once
 
 #include <atomic>
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <thread>
 #include <vector>
 
-#include "RequestHandler.h"
-#include "aeron_wrapper.h"
+#include "CountersFile.h"
+#include "IdleStrategy.h"
+#include "LatencyReporter.h"
+#include "Shard.h"
+#include "Transport.h"
 
 class eKYCEngine final {
    public:
+    // Serves requests from the Aeron channels in Config
     eKYCEngine() noexcept;
 
+    // Serves requests from transport instead, e.g. a LoopbackTransport; a
+    // null transport leaves the engine stopped
+    explicit eKYCEngine(std::unique_ptr<Transport> transport) noexcept;
+
     ~eKYCEngine() noexcept;
 
     void start() noexcept;
 
     void stop() noexcept;
 
+    // Report per-stage latencies if LATENCY_REPORT_INTERVAL_MS has elapsed,
+    // from a thread other than the poller
+    void report_latency() noexcept;
+
    private:
-    void receive_request(
-        const aeron_wrapper::FragmentData &fragmentData) noexcept;
-    void send_response(std::vector<char> &buffer) noexcept;
+    void poll() noexcept;
+    void receive_request(char *buffer, std::size_t length) noexcept;
+    std::size_t shard_index(char *buffer, std::uint64_t length) const;
+
+    // Requests in, responses out through each shard's publisher
+    std::unique_ptr<Transport> _transport;
+
+    // Poller duty cycle, idles per POLLER_IDLE_STRATEGY
+    std::thread _poller;
+    std::unique_ptr<IdleStrategy> _pollerIdleStrategy;
 
-    // Aeron components
-    std::unique_ptr<aeron_wrapper::Aeron> _aeron;
-    std::unique_ptr<aeron_wrapper::Subscription> _subscription;
-    std::unique_ptr<aeron_wrapper::Publication> _publication;
-    std::unique_ptr<aeron_wrapper::Subscription::BackgroundPoller>
-        _backgroundPoller;
+    static constexpr int FRAGMENT_LIMIT = 16;
 
     std::atomic<bool> _running;
-    std::uint64_t _requestReceived;
 
-    RequestHandler _requestHandler;
+    // Shared-memory counters for ekyc_stat, outlives the shards writing them
+    CountersFile _countersFile;
+    // Engine-wide counters, written by the poller thread
+    CounterSet _counters;
+    // Arrival order of requests across shards, written by the poller thread
+    std::uint64_t _sequence = 0;
+
+    // Workers, each with its own ring, RequestHandler and DB connection
+    std::vector<std::unique_ptr<Shard>> _shards;
+    // Null with LATENCY_STATS_ENABLED off
+    std::unique_ptr<LatencyReporter> _latencyReporter;
 };
@@ -2,9 +2,14 @@
 
 #include <algorithm>
 #include <cctype>
+#include <charconv>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <ios>
 #include <sstream>
 #include <string>
+#include <string_view>
 
 inline bool string_to_bool(const std::string& str) noexcept {
     std::istringstream iss(str);
@@ -21,6 +26,15 @@ inline bool string_to_bool(const std::string& str) noexcept {
     return b;
 }
 
+// Same rules as string_to_bool without building a stream, for the hot path
+inline bool string_view_to_bool(std::string_view str) noexcept {
+    if (str == "true") return true;
+    if (str == "false") return false;
+    int i = 0;
+    std::from_chars(str.data(), str.data() + str.size(), i);
+    return i != 0;
+}
+
 inline std::string bool_to_string(bool b) noexcept {
     std::ostringstream oss;
     oss << std::boolalpha << b;
@@ -36,3 +50,29 @@ inline void trim(std::string& str) noexcept {
                   .base(),
               str.end());
 }
+
+// FNV-1a hash over a byte range, stable across processes and builds
+inline std::uint64_t hash_bytes(const char* data, std::size_t length) noexcept {
+    std::uint64_t hash = 14695981039346656037ULL;
+    for (std::size_t i = 0; i < length; ++i) {
+        hash ^= static_cast<unsigned char>(data[i]);
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+// Shard owning an identity number. Routing and the per-shard caches must
+// agree on this, so both go through here.
+inline std::size_t shard_for_identity(const char* id, std::size_t length,
+                                      std::size_t numShards) noexcept {
+    return static_cast<std::size_t>(hash_bytes(id, length) % numShards);
+}
+
+// Wall-clock nanoseconds since the Unix epoch, the clock of the SBE timestamp
+// fields so they compare with client clocks kept in sync by NTP or PTP
+inline std::uint64_t epoch_nanos() noexcept {
+    return static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::system_clock::now().time_since_epoch())
+            .count());
+}
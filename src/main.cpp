@@ -10,11 +10,15 @@
 // Local Headers include
 #include "Config.h"
 #include "DatabaseFactory.h"
+#include "IdleStrategy.h"
+#include "Log.h"
 #include "MessageFlow.h"
 #include "eKYCEngine.h"
-#include "loggerlib.h"
 
 int main(int argc, char** argv) {
+    // Levels are filtered by the EKYC_LOG_* macros before anything reaches
+    // the logger, statements below EKYC_LOG_LEVEL are compiled out entirely
+    logging::set_level(logging::parse_level(Config::get().LOG_LEVEL));
     qLogger::get().initialize("logs/eKYCEngine.log", LogLevel::DEBUG);
 
     // Initialize the factory with default database types
@@ -34,8 +38,11 @@ int main(int argc, char** argv) {
 
         eKYC->start();
 
+        // Only watches for shutdown, the engine loops idle on their own
+        SleepingIdleStrategy idleStrategy(std::chrono::milliseconds(500));
         while (keepRunning) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(500));
+            idleStrategy.idle();
+            eKYC->report_latency();
         }
 
         if (inputThread.joinable()) inputThread.join();
@@ -43,7 +50,7 @@ int main(int argc, char** argv) {
         eKYC->stop();
         return EXIT_SUCCESS;
     } catch (const std::exception& e) {
-        qLogger::get().error_fast("Error: {}", e.what());
+        EKYC_LOG_ERROR("Error: {}", e.what());
         return EXIT_FAILURE;
     }
 }
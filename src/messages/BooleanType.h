@@ -0,0 +1,138 @@
+/* Generated SBE (Simple Binary Encoding) message codec */
+#ifndef _MY_APP_MESSAGES_BOOLEANTYPE_CXX_H_
+#define _MY_APP_MESSAGES_BOOLEANTYPE_CXX_H_
+
+#if __cplusplus >= 201103L
+#define SBE_CONSTEXPR constexpr
+#define SBE_NOEXCEPT noexcept
+#else
+#define SBE_CONSTEXPR
+#define SBE_NOEXCEPT
+#endif
+
+#if __cplusplus >= 201703L
+#include <string_view>
+#define SBE_NODISCARD [[nodiscard]]
+#if !defined(SBE_USE_STRING_VIEW)
+#define SBE_USE_STRING_VIEW 1
+#endif
+#else
+#define SBE_NODISCARD
+#endif
+
+#if __cplusplus >= 202002L
+#include <span>
+#if !defined(SBE_USE_SPAN)
+#define SBE_USE_SPAN 1
+#endif
+#endif
+
+#if !defined(__STDC_LIMIT_MACROS)
+#define __STDC_LIMIT_MACROS 1
+#endif
+
+#include <cstdint>
+#include <cstring>
+#include <iomanip>
+#include <limits>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#if defined(WIN32) || defined(_WIN32)
+#define SBE_BIG_ENDIAN_ENCODE_16(v) _byteswap_ushort(v)
+#define SBE_BIG_ENDIAN_ENCODE_32(v) _byteswap_ulong(v)
+#define SBE_BIG_ENDIAN_ENCODE_64(v) _byteswap_uint64(v)
+#define SBE_LITTLE_ENDIAN_ENCODE_16(v) (v)
+#define SBE_LITTLE_ENDIAN_ENCODE_32(v) (v)
+#define SBE_LITTLE_ENDIAN_ENCODE_64(v) (v)
+#elif __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define SBE_BIG_ENDIAN_ENCODE_16(v) __builtin_bswap16(v)
+#define SBE_BIG_ENDIAN_ENCODE_32(v) __builtin_bswap32(v)
+#define SBE_BIG_ENDIAN_ENCODE_64(v) __builtin_bswap64(v)
+#define SBE_LITTLE_ENDIAN_ENCODE_16(v) (v)
+#define SBE_LITTLE_ENDIAN_ENCODE_32(v) (v)
+#define SBE_LITTLE_ENDIAN_ENCODE_64(v) (v)
+#elif __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#define SBE_LITTLE_ENDIAN_ENCODE_16(v) __builtin_bswap16(v)
+#define SBE_LITTLE_ENDIAN_ENCODE_32(v) __builtin_bswap32(v)
+#define SBE_LITTLE_ENDIAN_ENCODE_64(v) __builtin_bswap64(v)
+#define SBE_BIG_ENDIAN_ENCODE_16(v) (v)
+#define SBE_BIG_ENDIAN_ENCODE_32(v) (v)
+#define SBE_BIG_ENDIAN_ENCODE_64(v) (v)
+#else
+#error \
+    "Byte Ordering of platform not determined. Set __BYTE_ORDER__ manually before including this file."
+#endif
+
+#if !defined(SBE_BOUNDS_CHECK_EXPECT)
+#if defined(SBE_NO_BOUNDS_CHECK)
+#define SBE_BOUNDS_CHECK_EXPECT(exp, c) (false)
+#elif defined(_MSC_VER)
+#define SBE_BOUNDS_CHECK_EXPECT(exp, c) (exp)
+#else
+#define SBE_BOUNDS_CHECK_EXPECT(exp, c) (__builtin_expect(exp, c))
+#endif
+
+#endif
+
+#define SBE_FLOAT_NAN std::numeric_limits<float>::quiet_NaN()
+#define SBE_DOUBLE_NAN std::numeric_limits<double>::quiet_NaN()
+#define SBE_NULLVALUE_INT8 (std::numeric_limits<std::int8_t>::min)()
+#define SBE_NULLVALUE_INT16 (std::numeric_limits<std::int16_t>::min)()
+#define SBE_NULLVALUE_INT32 (std::numeric_limits<std::int32_t>::min)()
+#define SBE_NULLVALUE_INT64 (std::numeric_limits<std::int64_t>::min)()
+#define SBE_NULLVALUE_UINT8 (std::numeric_limits<std::uint8_t>::max)()
+#define SBE_NULLVALUE_UINT16 (std::numeric_limits<std::uint16_t>::max)()
+#define SBE_NULLVALUE_UINT32 (std::numeric_limits<std::uint32_t>::max)()
+#define SBE_NULLVALUE_UINT64 (std::numeric_limits<std::uint64_t>::max)()
+
+namespace messages {
+
+class BooleanType {
+   public:
+    enum Value {
+        F = static_cast<std::uint8_t>(0),
+        T = static_cast<std::uint8_t>(1),
+        NULL_VALUE = static_cast<std::uint8_t>(255)
+    };
+
+    static BooleanType::Value get(const std::uint8_t value) {
+        switch (value) {
+            case 0:
+                return F;
+            case 1:
+                return T;
+            case 255:
+                return NULL_VALUE;
+        }
+
+        throw std::runtime_error("unknown value for enum BooleanType [E103]");
+    }
+
+    static const char *c_str(const BooleanType::Value value) {
+        switch (value) {
+            case F:
+                return "F";
+            case T:
+                return "T";
+            case NULL_VALUE:
+                return "NULL_VALUE";
+        }
+
+        throw std::runtime_error("unknown value for enum BooleanType [E103]:");
+    }
+
+    template <typename CharT, typename Traits>
+    friend std::basic_ostream<CharT, Traits> &operator<<(
+        std::basic_ostream<CharT, Traits> &os, BooleanType::Value m) {
+        return os << BooleanType::c_str(m);
+    }
+};
+
+}  // namespace messages
+
+#endif
@@ -176,7 +176,7 @@ class Char64str {
 
     SBE_NODISCARD static SBE_CONSTEXPR std::uint16_t sbeSchemaVersion()
         SBE_NOEXCEPT {
-        return static_cast<std::uint16_t>(1);
+        return static_cast<std::uint16_t>(5);
     }
 
     SBE_NODISCARD static const char *charValMetaAttribute(
@@ -0,0 +1,1240 @@
+/* Generated SBE (Simple Binary Encoding) message codec */
+#ifndef _MY_APP_MESSAGES_COMPACTIDENTITYMESSAGE_CXX_H_
+#define _MY_APP_MESSAGES_COMPACTIDENTITYMESSAGE_CXX_H_
+
+#if __cplusplus >= 201103L
+#define SBE_CONSTEXPR constexpr
+#define SBE_NOEXCEPT noexcept
+#else
+#define SBE_CONSTEXPR
+#define SBE_NOEXCEPT
+#endif
+
+#if __cplusplus >= 201703L
+#include <string_view>
+#define SBE_NODISCARD [[nodiscard]]
+#if !defined(SBE_USE_STRING_VIEW)
+#define SBE_USE_STRING_VIEW 1
+#endif
+#else
+#define SBE_NODISCARD
+#endif
+
+#if __cplusplus >= 202002L
+#include <span>
+#if !defined(SBE_USE_SPAN)
+#define SBE_USE_SPAN 1
+#endif
+#endif
+
+#if !defined(__STDC_LIMIT_MACROS)
+#define __STDC_LIMIT_MACROS 1
+#endif
+
+#include <cstdint>
+#include <cstring>
+#include <iomanip>
+#include <limits>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#if defined(WIN32) || defined(_WIN32)
+#define SBE_BIG_ENDIAN_ENCODE_16(v) _byteswap_ushort(v)
+#define SBE_BIG_ENDIAN_ENCODE_32(v) _byteswap_ulong(v)
+#define SBE_BIG_ENDIAN_ENCODE_64(v) _byteswap_uint64(v)
+#define SBE_LITTLE_ENDIAN_ENCODE_16(v) (v)
+#define SBE_LITTLE_ENDIAN_ENCODE_32(v) (v)
+#define SBE_LITTLE_ENDIAN_ENCODE_64(v) (v)
+#elif __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define SBE_BIG_ENDIAN_ENCODE_16(v) __builtin_bswap16(v)
+#define SBE_BIG_ENDIAN_ENCODE_32(v) __builtin_bswap32(v)
+#define SBE_BIG_ENDIAN_ENCODE_64(v) __builtin_bswap64(v)
+#define SBE_LITTLE_ENDIAN_ENCODE_16(v) (v)
+#define SBE_LITTLE_ENDIAN_ENCODE_32(v) (v)
+#define SBE_LITTLE_ENDIAN_ENCODE_64(v) (v)
+#elif __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#define SBE_LITTLE_ENDIAN_ENCODE_16(v) __builtin_bswap16(v)
+#define SBE_LITTLE_ENDIAN_ENCODE_32(v) __builtin_bswap32(v)
+#define SBE_LITTLE_ENDIAN_ENCODE_64(v) __builtin_bswap64(v)
+#define SBE_BIG_ENDIAN_ENCODE_16(v) (v)
+#define SBE_BIG_ENDIAN_ENCODE_32(v) (v)
+#define SBE_BIG_ENDIAN_ENCODE_64(v) (v)
+#else
+#error \
+    "Byte Ordering of platform not determined. Set __BYTE_ORDER__ manually before including this file."
+#endif
+
+#if !defined(SBE_BOUNDS_CHECK_EXPECT)
+#if defined(SBE_NO_BOUNDS_CHECK)
+#define SBE_BOUNDS_CHECK_EXPECT(exp, c) (false)
+#elif defined(_MSC_VER)
+#define SBE_BOUNDS_CHECK_EXPECT(exp, c) (exp)
+#else
+#define SBE_BOUNDS_CHECK_EXPECT(exp, c) (__builtin_expect(exp, c))
+#endif
+
+#endif
+
+#define SBE_FLOAT_NAN std::numeric_limits<float>::quiet_NaN()
+#define SBE_DOUBLE_NAN std::numeric_limits<double>::quiet_NaN()
+#define SBE_NULLVALUE_INT8 (std::numeric_limits<std::int8_t>::min)()
+#define SBE_NULLVALUE_INT16 (std::numeric_limits<std::int16_t>::min)()
+#define SBE_NULLVALUE_INT32 (std::numeric_limits<std::int32_t>::min)()
+#define SBE_NULLVALUE_INT64 (std::numeric_limits<std::int64_t>::min)()
+#define SBE_NULLVALUE_UINT8 (std::numeric_limits<std::uint8_t>::max)()
+#define SBE_NULLVALUE_UINT16 (std::numeric_limits<std::uint16_t>::max)()
+#define SBE_NULLVALUE_UINT32 (std::numeric_limits<std::uint32_t>::max)()
+#define SBE_NULLVALUE_UINT64 (std::numeric_limits<std::uint64_t>::max)()
+
+#include "BooleanType.h"
+#include "IdentityType.h"
+#include "MessageHeader.h"
+#include "MessageKind.h"
+#include "VarStringEncoding.h"
+
+namespace messages {
+
+class CompactIdentityMessage {
+   private:
+    char *m_buffer = nullptr;
+    std::uint64_t m_bufferLength = 0;
+    std::uint64_t m_offset = 0;
+    std::uint64_t m_position = 0;
+    std::uint64_t m_actingBlockLength = 0;
+    std::uint64_t m_actingVersion = 0;
+
+    inline std::uint64_t *sbePositionPtr() SBE_NOEXCEPT { return &m_position; }
+
+   public:
+    static constexpr std::uint16_t SBE_BLOCK_LENGTH =
+        static_cast<std::uint16_t>(59);
+    static constexpr std::uint16_t SBE_TEMPLATE_ID =
+        static_cast<std::uint16_t>(2);
+    static constexpr std::uint16_t SBE_SCHEMA_ID =
+        static_cast<std::uint16_t>(1);
+    static constexpr std::uint16_t SBE_SCHEMA_VERSION =
+        static_cast<std::uint16_t>(5);
+    static constexpr const char *SBE_SEMANTIC_VERSION = "1.4.0";
+
+    enum MetaAttribute { EPOCH, TIME_UNIT, SEMANTIC_TYPE, PRESENCE };
+
+    union sbe_float_as_uint_u {
+        float fp_value;
+        std::uint32_t uint_value;
+    };
+
+    union sbe_double_as_uint_u {
+        double fp_value;
+        std::uint64_t uint_value;
+    };
+
+    using messageHeader = MessageHeader;
+
+    CompactIdentityMessage() = default;
+
+    CompactIdentityMessage(char *buffer, const std::uint64_t offset,
+                    const std::uint64_t bufferLength,
+                    const std::uint64_t actingBlockLength,
+                    const std::uint64_t actingVersion)
+        : m_buffer(buffer),
+          m_bufferLength(bufferLength),
+          m_offset(offset),
+          m_position(sbeCheckPosition(offset + actingBlockLength)),
+          m_actingBlockLength(actingBlockLength),
+          m_actingVersion(actingVersion) {}
+
+    CompactIdentityMessage(char *buffer, const std::uint64_t bufferLength)
+        : CompactIdentityMessage(buffer, 0, bufferLength, sbeBlockLength(),
+                          sbeSchemaVersion()) {}
+
+    CompactIdentityMessage(char *buffer, const std::uint64_t bufferLength,
+                    const std::uint64_t actingBlockLength,
+                    const std::uint64_t actingVersion)
+        : CompactIdentityMessage(buffer, 0, bufferLength, actingBlockLength,
+                          actingVersion) {}
+
+    SBE_NODISCARD static SBE_CONSTEXPR std::uint16_t sbeBlockLength()
+        SBE_NOEXCEPT {
+        return static_cast<std::uint16_t>(59);
+    }
+
+    SBE_NODISCARD static SBE_CONSTEXPR std::uint64_t sbeBlockAndHeaderLength()
+        SBE_NOEXCEPT {
+        return messageHeader::encodedLength() + sbeBlockLength();
+    }
+
+    SBE_NODISCARD static SBE_CONSTEXPR std::uint16_t sbeTemplateId()
+        SBE_NOEXCEPT {
+        return static_cast<std::uint16_t>(2);
+    }
+
+    SBE_NODISCARD static SBE_CONSTEXPR std::uint16_t sbeSchemaId()
+        SBE_NOEXCEPT {
+        return static_cast<std::uint16_t>(1);
+    }
+
+    SBE_NODISCARD static SBE_CONSTEXPR std::uint16_t sbeSchemaVersion()
+        SBE_NOEXCEPT {
+        return static_cast<std::uint16_t>(5);
+    }
+
+    SBE_NODISCARD static const char *sbeSemanticVersion() SBE_NOEXCEPT {
+        return "1.4.0";
+    }
+
+    SBE_NODISCARD static SBE_CONSTEXPR const char *sbeSemanticType()
+        SBE_NOEXCEPT {
+        return "";
+    }
+
+    SBE_NODISCARD std::uint64_t offset() const SBE_NOEXCEPT { return m_offset; }
+
+    CompactIdentityMessage &wrapForEncode(char *buffer, const std::uint64_t offset,
+                                   const std::uint64_t bufferLength) {
+        m_buffer = buffer;
+        m_bufferLength = bufferLength;
+        m_offset = offset;
+        m_actingBlockLength = sbeBlockLength();
+        m_actingVersion = sbeSchemaVersion();
+        m_position = sbeCheckPosition(m_offset + m_actingBlockLength);
+        return *this;
+    }
+
+    CompactIdentityMessage &wrapAndApplyHeader(char *buffer,
+                                        const std::uint64_t offset,
+                                        const std::uint64_t bufferLength) {
+        messageHeader hdr(buffer, offset, bufferLength, sbeSchemaVersion());
+
+        hdr.blockLength(sbeBlockLength())
+            .templateId(sbeTemplateId())
+            .schemaId(sbeSchemaId())
+            .version(sbeSchemaVersion());
+
+        m_buffer = buffer;
+        m_bufferLength = bufferLength;
+        m_offset = offset + messageHeader::encodedLength();
+        m_actingBlockLength = sbeBlockLength();
+        m_actingVersion = sbeSchemaVersion();
+        m_position = sbeCheckPosition(m_offset + m_actingBlockLength);
+        return *this;
+    }
+
+    CompactIdentityMessage &wrapForDecode(char *buffer, const std::uint64_t offset,
+                                   const std::uint64_t actingBlockLength,
+                                   const std::uint64_t actingVersion,
+                                   const std::uint64_t bufferLength) {
+        m_buffer = buffer;
+        m_bufferLength = bufferLength;
+        m_offset = offset;
+        m_actingBlockLength = actingBlockLength;
+        m_actingVersion = actingVersion;
+        m_position = sbeCheckPosition(m_offset + m_actingBlockLength);
+        return *this;
+    }
+
+    CompactIdentityMessage &sbeRewind() {
+        return wrapForDecode(m_buffer, m_offset, m_actingBlockLength,
+                             m_actingVersion, m_bufferLength);
+    }
+
+    SBE_NODISCARD std::uint64_t sbePosition() const SBE_NOEXCEPT {
+        return m_position;
+    }
+
+    // NOLINTNEXTLINE(readability-convert-member-functions-to-static)
+    std::uint64_t sbeCheckPosition(const std::uint64_t position) {
+        if (SBE_BOUNDS_CHECK_EXPECT((position > m_bufferLength), false)) {
+            throw std::runtime_error("buffer too short [E100]");
+        }
+        return position;
+    }
+
+    void sbePosition(const std::uint64_t position) {
+        m_position = sbeCheckPosition(position);
+    }
+
+    SBE_NODISCARD std::uint64_t encodedLength() const SBE_NOEXCEPT {
+        return sbePosition() - m_offset;
+    }
+
+    SBE_NODISCARD std::uint64_t decodeLength() const {
+        CompactIdentityMessage skipper(m_buffer, m_offset, m_bufferLength,
+                                m_actingBlockLength, m_actingVersion);
+        skipper.skip();
+        return skipper.encodedLength();
+    }
+
+    SBE_NODISCARD const char *buffer() const SBE_NOEXCEPT { return m_buffer; }
+
+    SBE_NODISCARD char *buffer() SBE_NOEXCEPT { return m_buffer; }
+
+    SBE_NODISCARD std::uint64_t bufferLength() const SBE_NOEXCEPT {
+        return m_bufferLength;
+    }
+
+    SBE_NODISCARD std::uint64_t actingVersion() const SBE_NOEXCEPT {
+        return m_actingVersion;
+    }
+
+    SBE_NODISCARD static const char *kindMetaAttribute(
+        const MetaAttribute metaAttribute) SBE_NOEXCEPT {
+        switch (metaAttribute) {
+            case MetaAttribute::PRESENCE:
+                return "required";
+            default:
+                return "";
+        }
+    }
+
+    static SBE_CONSTEXPR std::uint16_t kindId() SBE_NOEXCEPT { return 1; }
+
+    SBE_NODISCARD static SBE_CONSTEXPR std::uint64_t kindSinceVersion()
+        SBE_NOEXCEPT {
+        return 0;
+    }
+
+    SBE_NODISCARD bool kindInActingVersion() SBE_NOEXCEPT { return true; }
+
+    SBE_NODISCARD static SBE_CONSTEXPR std::size_t kindEncodingOffset()
+        SBE_NOEXCEPT {
+        return 0;
+    }
+
+    SBE_NODISCARD static SBE_CONSTEXPR std::size_t kindEncodingLength()
+        SBE_NOEXCEPT {
+        return 1;
+    }
+
+    SBE_NODISCARD std::uint8_t kindRaw() const SBE_NOEXCEPT {
+        std::uint8_t val;
+        std::memcpy(&val, m_buffer + m_offset + 0, sizeof(std::uint8_t));
+        return (val);
+    }
+
+    SBE_NODISCARD MessageKind::Value kind() const {
+        std::uint8_t val;
+        std::memcpy(&val, m_buffer + m_offset + 0, sizeof(std::uint8_t));
+        return MessageKind::get((val));
+    }
+
+    CompactIdentityMessage &kind(const MessageKind::Value value) SBE_NOEXCEPT {
+        std::uint8_t val = (value);
+        std::memcpy(m_buffer + m_offset + 0, &val, sizeof(std::uint8_t));
+        return *this;
+    }
+
+    SBE_NODISCARD static const char *isVerifiedMetaAttribute(
+        const MetaAttribute metaAttribute) SBE_NOEXCEPT {
+        switch (metaAttribute) {
+            case MetaAttribute::PRESENCE:
+                return "required";
+            default:
+                return "";
+        }
+    }
+
+    static SBE_CONSTEXPR std::uint16_t isVerifiedId() SBE_NOEXCEPT { return 2; }
+
+    SBE_NODISCARD static SBE_CONSTEXPR std::uint64_t isVerifiedSinceVersion()
+        SBE_NOEXCEPT {
+        return 0;
+    }
+
+    SBE_NODISCARD bool isVerifiedInActingVersion() SBE_NOEXCEPT { return true; }
+
+    SBE_NODISCARD static SBE_CONSTEXPR std::size_t isVerifiedEncodingOffset()
+        SBE_NOEXCEPT {
+        return 1;
+    }
+
+    SBE_NODISCARD static SBE_CONSTEXPR std::size_t isVerifiedEncodingLength()
+        SBE_NOEXCEPT {
+        return 1;
+    }
+
+    SBE_NODISCARD std::uint8_t isVerifiedRaw() const SBE_NOEXCEPT {
+        std::uint8_t val;
+        std::memcpy(&val, m_buffer + m_offset + 1, sizeof(std::uint8_t));
+        return (val);
+    }
+
+    SBE_NODISCARD BooleanType::Value isVerified() const {
+        std::uint8_t val;
+        std::memcpy(&val, m_buffer + m_offset + 1, sizeof(std::uint8_t));
+        return BooleanType::get((val));
+    }
+
+    CompactIdentityMessage &isVerified(const BooleanType::Value value) SBE_NOEXCEPT {
+        std::uint8_t val = (value);
+        std::memcpy(m_buffer + m_offset + 1, &val, sizeof(std::uint8_t));
+        return *this;
+    }
+
+    SBE_NODISCARD static const char *typeMetaAttribute(
+        const MetaAttribute metaAttribute) SBE_NOEXCEPT {
+        switch (metaAttribute) {
+            case MetaAttribute::PRESENCE:
+                return "required";
+            default:
+                return "";
+        }
+    }
+
+    static SBE_CONSTEXPR std::uint16_t typeId() SBE_NOEXCEPT { return 3; }
+
+    SBE_NODISCARD static SBE_CONSTEXPR std::uint64_t typeSinceVersion()
+        SBE_NOEXCEPT {
+        return 0;
+    }
+
+    SBE_NODISCARD bool typeInActingVersion() SBE_NOEXCEPT { return true; }
+
+    SBE_NODISCARD static SBE_CONSTEXPR std::size_t typeEncodingOffset()
+        SBE_NOEXCEPT {
+        return 2;
+    }
+
+    SBE_NODISCARD static SBE_CONSTEXPR std::size_t typeEncodingLength()
+        SBE_NOEXCEPT {
+        return 1;
+    }
+
+    SBE_NODISCARD std::uint8_t typeRaw() const SBE_NOEXCEPT {
+        std::uint8_t val;
+        std::memcpy(&val, m_buffer + m_offset + 2, sizeof(std::uint8_t));
+        return (val);
+    }
+
+    SBE_NODISCARD IdentityType::Value type() const {
+        std::uint8_t val;
+        std::memcpy(&val, m_buffer + m_offset + 2, sizeof(std::uint8_t));
+        return IdentityType::get((val));
+    }
+
+    CompactIdentityMessage &type(const IdentityType::Value value) SBE_NOEXCEPT {
+        std::uint8_t val = (value);
+        std::memcpy(m_buffer + m_offset + 2, &val, sizeof(std::uint8_t));
+        return *this;
+    }
+
+    SBE_NODISCARD static const char *idMetaAttribute(
+        const MetaAttribute metaAttribute) SBE_NOEXCEPT {
+        switch (metaAttribute) {
+            case MetaAttribute::PRESENCE:
+                return "required";
+            default:
+                return "";
+        }
+    }
+
+    static SBE_CONSTEXPR std::uint16_t idId() SBE_NOEXCEPT { return 4; }
+
+    SBE_NODISCARD static SBE_CONSTEXPR std::uint64_t idSinceVersion()
+        SBE_NOEXCEPT {
+        return 0;
+    }
+
+    SBE_NODISCARD bool idInActingVersion() SBE_NOEXCEPT { return true; }
+
+    SBE_NODISCARD static SBE_CONSTEXPR std::size_t idEncodingOffset()
+        SBE_NOEXCEPT {
+        return 3;
+    }
+
+    SBE_NODISCARD static SBE_CONSTEXPR std::size_t idEncodingLength()
+        SBE_NOEXCEPT {
+        return 16;
+    }
+
+    static SBE_CONSTEXPR char idNullValue() SBE_NOEXCEPT {
+        return static_cast<char>(0);
+    }
+
+    static SBE_CONSTEXPR std::uint64_t idLength() SBE_NOEXCEPT {
+        return 16;
+    }
+
+    SBE_NODISCARD const char *id() const SBE_NOEXCEPT {
+        return m_buffer + m_offset + 3;
+    }
+
+    SBE_NODISCARD char *id() SBE_NOEXCEPT {
+        return m_buffer + m_offset + 3;
+    }
+
+    std::uint64_t getId(char *const dst, const std::uint64_t length) const {
+        if (length > 16) {
+            throw std::runtime_error("length too large for getId [E106]");
+        }
+
+        std::memcpy(dst, m_buffer + m_offset + 3,
+                    sizeof(char) * static_cast<std::size_t>(length));
+        return length;
+    }
+
+    SBE_NODISCARD std::string getIdAsString() const {
+        const char *buffer = m_buffer + m_offset + 3;
+        std::size_t length = 0;
+
+        for (; length < 16 && *(buffer + length) != '\0'; ++length);
+        std::string result(buffer, length);
+
+        return result;
+    }
+
+#ifdef SBE_USE_STRING_VIEW
+    SBE_NODISCARD std::string_view getIdAsStringView() const SBE_NOEXCEPT {
+        const char *buffer = m_buffer + m_offset + 3;
+        std::size_t length = 0;
+
+        for (; length < 16 && *(buffer + length) != '\0'; ++length);
+        std::string_view result(buffer, length);
+
+        return result;
+    }
+
+    CompactIdentityMessage &putId(const std::string_view str) {
+        const std::size_t srcLength = str.length();
+        if (srcLength > 16) {
+            throw std::runtime_error("string too large for putId [E106]");
+        }
+
+        std::memcpy(m_buffer + m_offset + 3, str.data(), srcLength);
+        for (std::size_t start = srcLength; start < 16; ++start) {
+            m_buffer[m_offset + 3 + start] = 0;
+        }
+
+        return *this;
+    }
+#else
+    CompactIdentityMessage &putId(const std::string &str) {
+        const std::size_t srcLength = str.length();
+        if (srcLength > 16) {
+            throw std::runtime_error("string too large for putId [E106]");
+        }
+
+        std::memcpy(m_buffer + m_offset + 3, str.c_str(), srcLength);
+        for (std::size_t start = srcLength; start < 16; ++start) {
+            m_buffer[m_offset + 3 + start] = 0;
+        }
+
+        return *this;
+    }
+#endif
+
+    SBE_NODISCARD static const char *dateOfIssueMetaAttribute(
+        const MetaAttribute metaAttribute) SBE_NOEXCEPT {
+        switch (metaAttribute) {
+            case MetaAttribute::PRESENCE:
+                return "required";
+            default:
+                return "";
+        }
+    }
+
+    static SBE_CONSTEXPR std::uint16_t dateOfIssueId() SBE_NOEXCEPT { return 5; }
+
+    SBE_NODISCARD static SBE_CONSTEXPR std::uint64_t dateOfIssueSinceVersion()
+        SBE_NOEXCEPT {
+        return 0;
+    }
+
+    SBE_NODISCARD bool dateOfIssueInActingVersion() SBE_NOEXCEPT { return true; }
+
+    SBE_NODISCARD static SBE_CONSTEXPR std::size_t dateOfIssueEncodingOffset()
+        SBE_NOEXCEPT {
+        return 19;
+    }
+
+    SBE_NODISCARD static SBE_CONSTEXPR std::size_t dateOfIssueEncodingLength()
+        SBE_NOEXCEPT {
+        return 4;
+    }
+
+    static SBE_CONSTEXPR std::uint32_t dateOfIssueNullValue() SBE_NOEXCEPT {
+        return SBE_NULLVALUE_UINT32;
+    }
+
+    static SBE_CONSTEXPR std::uint32_t dateOfIssueMinValue() SBE_NOEXCEPT {
+        return UINT32_C(0x0);
+    }
+
+    static SBE_CONSTEXPR std::uint32_t dateOfIssueMaxValue() SBE_NOEXCEPT {
+        return UINT32_C(0xfffffffe);
+    }
+
+    SBE_NODISCARD std::uint32_t dateOfIssue() const SBE_NOEXCEPT {
+        std::uint32_t val;
+        std::memcpy(&val, m_buffer + m_offset + 19, sizeof(std::uint32_t));
+        return SBE_LITTLE_ENDIAN_ENCODE_32(val);
+    }
+
+    CompactIdentityMessage &dateOfIssue(const std::uint32_t value) SBE_NOEXCEPT {
+        std::uint32_t val = SBE_LITTLE_ENDIAN_ENCODE_32(value);
+        std::memcpy(m_buffer + m_offset + 19, &val, sizeof(std::uint32_t));
+        return *this;
+    }
+
+    SBE_NODISCARD static const char *dateOfExpiryMetaAttribute(
+        const MetaAttribute metaAttribute) SBE_NOEXCEPT {
+        switch (metaAttribute) {
+            case MetaAttribute::PRESENCE:
+                return "required";
+            default:
+                return "";
+        }
+    }
+
+    static SBE_CONSTEXPR std::uint16_t dateOfExpiryId() SBE_NOEXCEPT { return 6; }
+
+    SBE_NODISCARD static SBE_CONSTEXPR std::uint64_t dateOfExpirySinceVersion()
+        SBE_NOEXCEPT {
+        return 0;
+    }
+
+    SBE_NODISCARD bool dateOfExpiryInActingVersion() SBE_NOEXCEPT { return true; }
+
+    SBE_NODISCARD static SBE_CONSTEXPR std::size_t dateOfExpiryEncodingOffset()
+        SBE_NOEXCEPT {
+        return 23;
+    }
+
+    SBE_NODISCARD static SBE_CONSTEXPR std::size_t dateOfExpiryEncodingLength()
+        SBE_NOEXCEPT {
+        return 4;
+    }
+
+    static SBE_CONSTEXPR std::uint32_t dateOfExpiryNullValue() SBE_NOEXCEPT {
+        return SBE_NULLVALUE_UINT32;
+    }
+
+    static SBE_CONSTEXPR std::uint32_t dateOfExpiryMinValue() SBE_NOEXCEPT {
+        return UINT32_C(0x0);
+    }
+
+    static SBE_CONSTEXPR std::uint32_t dateOfExpiryMaxValue() SBE_NOEXCEPT {
+        return UINT32_C(0xfffffffe);
+    }
+
+    SBE_NODISCARD std::uint32_t dateOfExpiry() const SBE_NOEXCEPT {
+        std::uint32_t val;
+        std::memcpy(&val, m_buffer + m_offset + 23, sizeof(std::uint32_t));
+        return SBE_LITTLE_ENDIAN_ENCODE_32(val);
+    }
+
+    CompactIdentityMessage &dateOfExpiry(const std::uint32_t value) SBE_NOEXCEPT {
+        std::uint32_t val = SBE_LITTLE_ENDIAN_ENCODE_32(value);
+        std::memcpy(m_buffer + m_offset + 23, &val, sizeof(std::uint32_t));
+        return *this;
+    }
+
+    SBE_NODISCARD static const char *correlationIdMetaAttribute(
+        const MetaAttribute metaAttribute) SBE_NOEXCEPT {
+        switch (metaAttribute) {
+            case MetaAttribute::PRESENCE:
+                return "required";
+            default:
+                return "";
+        }
+    }
+
+    static SBE_CONSTEXPR std::uint16_t correlationIdId() SBE_NOEXCEPT { return 9; }
+
+    SBE_NODISCARD static SBE_CONSTEXPR std::uint64_t correlationIdSinceVersion()
+        SBE_NOEXCEPT {
+        return 5;
+    }
+
+    SBE_NODISCARD bool correlationIdInActingVersion() SBE_NOEXCEPT {
+        return m_actingVersion >= correlationIdSinceVersion();
+    }
+
+    SBE_NODISCARD static SBE_CONSTEXPR std::size_t correlationIdEncodingOffset()
+        SBE_NOEXCEPT {
+        return 27;
+    }
+
+    SBE_NODISCARD static SBE_CONSTEXPR std::size_t correlationIdEncodingLength()
+        SBE_NOEXCEPT {
+        return 8;
+    }
+
+    static SBE_CONSTEXPR std::uint64_t correlationIdNullValue() SBE_NOEXCEPT {
+        return SBE_NULLVALUE_UINT64;
+    }
+
+    static SBE_CONSTEXPR std::uint64_t correlationIdMinValue() SBE_NOEXCEPT {
+        return UINT64_C(0x0);
+    }
+
+    static SBE_CONSTEXPR std::uint64_t correlationIdMaxValue() SBE_NOEXCEPT {
+        return UINT64_C(0xfffffffffffffffe);
+    }
+
+    SBE_NODISCARD std::uint64_t correlationId() const SBE_NOEXCEPT {
+        if (m_actingVersion < 5) {
+            return SBE_NULLVALUE_UINT64;
+        }
+
+        std::uint64_t val;
+        std::memcpy(&val, m_buffer + m_offset + 27, sizeof(std::uint64_t));
+        return SBE_LITTLE_ENDIAN_ENCODE_64(val);
+    }
+
+    CompactIdentityMessage &correlationId(const std::uint64_t value) SBE_NOEXCEPT {
+        std::uint64_t val = SBE_LITTLE_ENDIAN_ENCODE_64(value);
+        std::memcpy(m_buffer + m_offset + 27, &val, sizeof(std::uint64_t));
+        return *this;
+    }
+
+    SBE_NODISCARD static const char *clientSendTimeNsMetaAttribute(
+        const MetaAttribute metaAttribute) SBE_NOEXCEPT {
+        switch (metaAttribute) {
+            case MetaAttribute::PRESENCE:
+                return "required";
+            default:
+                return "";
+        }
+    }
+
+    static SBE_CONSTEXPR std::uint16_t clientSendTimeNsId() SBE_NOEXCEPT { return 10; }
+
+    SBE_NODISCARD static SBE_CONSTEXPR std::uint64_t clientSendTimeNsSinceVersion()
+        SBE_NOEXCEPT {
+        return 5;
+    }
+
+    SBE_NODISCARD bool clientSendTimeNsInActingVersion() SBE_NOEXCEPT {
+        return m_actingVersion >= clientSendTimeNsSinceVersion();
+    }
+
+    SBE_NODISCARD static SBE_CONSTEXPR std::size_t clientSendTimeNsEncodingOffset()
+        SBE_NOEXCEPT {
+        return 35;
+    }
+
+    SBE_NODISCARD static SBE_CONSTEXPR std::size_t clientSendTimeNsEncodingLength()
+        SBE_NOEXCEPT {
+        return 8;
+    }
+
+    static SBE_CONSTEXPR std::uint64_t clientSendTimeNsNullValue() SBE_NOEXCEPT {
+        return SBE_NULLVALUE_UINT64;
+    }
+
+    static SBE_CONSTEXPR std::uint64_t clientSendTimeNsMinValue() SBE_NOEXCEPT {
+        return UINT64_C(0x0);
+    }
+
+    static SBE_CONSTEXPR std::uint64_t clientSendTimeNsMaxValue() SBE_NOEXCEPT {
+        return UINT64_C(0xfffffffffffffffe);
+    }
+
+    SBE_NODISCARD std::uint64_t clientSendTimeNs() const SBE_NOEXCEPT {
+        if (m_actingVersion < 5) {
+            return SBE_NULLVALUE_UINT64;
+        }
+
+        std::uint64_t val;
+        std::memcpy(&val, m_buffer + m_offset + 35, sizeof(std::uint64_t));
+        return SBE_LITTLE_ENDIAN_ENCODE_64(val);
+    }
+
+    CompactIdentityMessage &clientSendTimeNs(const std::uint64_t value) SBE_NOEXCEPT {
+        std::uint64_t val = SBE_LITTLE_ENDIAN_ENCODE_64(value);
+        std::memcpy(m_buffer + m_offset + 35, &val, sizeof(std::uint64_t));
+        return *this;
+    }
+
+    SBE_NODISCARD static const char *engineReceiveTimeNsMetaAttribute(
+        const MetaAttribute metaAttribute) SBE_NOEXCEPT {
+        switch (metaAttribute) {
+            case MetaAttribute::PRESENCE:
+                return "required";
+            default:
+                return "";
+        }
+    }
+
+    static SBE_CONSTEXPR std::uint16_t engineReceiveTimeNsId() SBE_NOEXCEPT { return 11; }
+
+    SBE_NODISCARD static SBE_CONSTEXPR std::uint64_t engineReceiveTimeNsSinceVersion()
+        SBE_NOEXCEPT {
+        return 5;
+    }
+
+    SBE_NODISCARD bool engineReceiveTimeNsInActingVersion() SBE_NOEXCEPT {
+        return m_actingVersion >= engineReceiveTimeNsSinceVersion();
+    }
+
+    SBE_NODISCARD static SBE_CONSTEXPR std::size_t engineReceiveTimeNsEncodingOffset()
+        SBE_NOEXCEPT {
+        return 43;
+    }
+
+    SBE_NODISCARD static SBE_CONSTEXPR std::size_t engineReceiveTimeNsEncodingLength()
+        SBE_NOEXCEPT {
+        return 8;
+    }
+
+    static SBE_CONSTEXPR std::uint64_t engineReceiveTimeNsNullValue() SBE_NOEXCEPT {
+        return SBE_NULLVALUE_UINT64;
+    }
+
+    static SBE_CONSTEXPR std::uint64_t engineReceiveTimeNsMinValue() SBE_NOEXCEPT {
+        return UINT64_C(0x0);
+    }
+
+    static SBE_CONSTEXPR std::uint64_t engineReceiveTimeNsMaxValue() SBE_NOEXCEPT {
+        return UINT64_C(0xfffffffffffffffe);
+    }
+
+    SBE_NODISCARD std::uint64_t engineReceiveTimeNs() const SBE_NOEXCEPT {
+        if (m_actingVersion < 5) {
+            return SBE_NULLVALUE_UINT64;
+        }
+
+        std::uint64_t val;
+        std::memcpy(&val, m_buffer + m_offset + 43, sizeof(std::uint64_t));
+        return SBE_LITTLE_ENDIAN_ENCODE_64(val);
+    }
+
+    CompactIdentityMessage &engineReceiveTimeNs(const std::uint64_t value) SBE_NOEXCEPT {
+        std::uint64_t val = SBE_LITTLE_ENDIAN_ENCODE_64(value);
+        std::memcpy(m_buffer + m_offset + 43, &val, sizeof(std::uint64_t));
+        return *this;
+    }
+
+    SBE_NODISCARD static const char *engineSendTimeNsMetaAttribute(
+        const MetaAttribute metaAttribute) SBE_NOEXCEPT {
+        switch (metaAttribute) {
+            case MetaAttribute::PRESENCE:
+                return "required";
+            default:
+                return "";
+        }
+    }
+
+    static SBE_CONSTEXPR std::uint16_t engineSendTimeNsId() SBE_NOEXCEPT { return 12; }
+
+    SBE_NODISCARD static SBE_CONSTEXPR std::uint64_t engineSendTimeNsSinceVersion()
+        SBE_NOEXCEPT {
+        return 5;
+    }
+
+    SBE_NODISCARD bool engineSendTimeNsInActingVersion() SBE_NOEXCEPT {
+        return m_actingVersion >= engineSendTimeNsSinceVersion();
+    }
+
+    SBE_NODISCARD static SBE_CONSTEXPR std::size_t engineSendTimeNsEncodingOffset()
+        SBE_NOEXCEPT {
+        return 51;
+    }
+
+    SBE_NODISCARD static SBE_CONSTEXPR std::size_t engineSendTimeNsEncodingLength()
+        SBE_NOEXCEPT {
+        return 8;
+    }
+
+    static SBE_CONSTEXPR std::uint64_t engineSendTimeNsNullValue() SBE_NOEXCEPT {
+        return SBE_NULLVALUE_UINT64;
+    }
+
+    static SBE_CONSTEXPR std::uint64_t engineSendTimeNsMinValue() SBE_NOEXCEPT {
+        return UINT64_C(0x0);
+    }
+
+    static SBE_CONSTEXPR std::uint64_t engineSendTimeNsMaxValue() SBE_NOEXCEPT {
+        return UINT64_C(0xfffffffffffffffe);
+    }
+
+    SBE_NODISCARD std::uint64_t engineSendTimeNs() const SBE_NOEXCEPT {
+        if (m_actingVersion < 5) {
+            return SBE_NULLVALUE_UINT64;
+        }
+
+        std::uint64_t val;
+        std::memcpy(&val, m_buffer + m_offset + 51, sizeof(std::uint64_t));
+        return SBE_LITTLE_ENDIAN_ENCODE_64(val);
+    }
+
+    CompactIdentityMessage &engineSendTimeNs(const std::uint64_t value) SBE_NOEXCEPT {
+        std::uint64_t val = SBE_LITTLE_ENDIAN_ENCODE_64(value);
+        std::memcpy(m_buffer + m_offset + 51, &val, sizeof(std::uint64_t));
+        return *this;
+    }
+
+    SBE_NODISCARD static const char *nameMetaAttribute(
+        const MetaAttribute metaAttribute) SBE_NOEXCEPT {
+        switch (metaAttribute) {
+            case MetaAttribute::PRESENCE:
+                return "required";
+            default:
+                return "";
+        }
+    }
+
+    static const char *nameCharacterEncoding() SBE_NOEXCEPT {
+        return "UTF-8";
+    }
+
+    SBE_NODISCARD static SBE_CONSTEXPR std::uint64_t nameSinceVersion()
+        SBE_NOEXCEPT {
+        return 0;
+    }
+
+    bool nameInActingVersion() SBE_NOEXCEPT { return true; }
+
+    static SBE_CONSTEXPR std::uint16_t nameId() SBE_NOEXCEPT { return 7; }
+
+    static SBE_CONSTEXPR std::uint64_t nameHeaderLength() SBE_NOEXCEPT {
+        return 2;
+    }
+
+    SBE_NODISCARD std::uint16_t nameLength() const {
+        std::uint16_t length;
+        std::memcpy(&length, m_buffer + sbePosition(), sizeof(std::uint16_t));
+        return SBE_LITTLE_ENDIAN_ENCODE_16(length);
+    }
+
+    std::uint64_t skipName() {
+        std::uint64_t lengthOfLengthField = 2;
+        std::uint64_t lengthPosition = sbePosition();
+        std::uint16_t lengthFieldValue;
+        std::memcpy(&lengthFieldValue, m_buffer + lengthPosition,
+                    sizeof(std::uint16_t));
+        std::uint64_t dataLength =
+            SBE_LITTLE_ENDIAN_ENCODE_16(lengthFieldValue);
+        sbePosition(lengthPosition + lengthOfLengthField + dataLength);
+        return dataLength;
+    }
+
+    SBE_NODISCARD const char *name() {
+        std::uint16_t lengthFieldValue;
+        std::memcpy(&lengthFieldValue, m_buffer + sbePosition(),
+                    sizeof(std::uint16_t));
+        const char *fieldPtr = m_buffer + sbePosition() + 2;
+        sbePosition(sbePosition() + 2 +
+                    SBE_LITTLE_ENDIAN_ENCODE_16(lengthFieldValue));
+        return fieldPtr;
+    }
+
+    std::uint64_t getName(char *dst, const std::uint64_t length) {
+        std::uint64_t lengthOfLengthField = 2;
+        std::uint64_t lengthPosition = sbePosition();
+        sbePosition(lengthPosition + lengthOfLengthField);
+        std::uint16_t lengthFieldValue;
+        std::memcpy(&lengthFieldValue, m_buffer + lengthPosition,
+                    sizeof(std::uint16_t));
+        std::uint64_t dataLength =
+            SBE_LITTLE_ENDIAN_ENCODE_16(lengthFieldValue);
+        std::uint64_t bytesToCopy = length < dataLength ? length : dataLength;
+        std::uint64_t pos = sbePosition();
+        sbePosition(pos + dataLength);
+        std::memcpy(dst, m_buffer + pos, static_cast<std::size_t>(bytesToCopy));
+        return bytesToCopy;
+    }
+
+    CompactIdentityMessage &putName(const char *src,
+                                     const std::uint16_t length) {
+        std::uint64_t lengthOfLengthField = 2;
+        std::uint64_t lengthPosition = sbePosition();
+        std::uint16_t lengthFieldValue = SBE_LITTLE_ENDIAN_ENCODE_16(length);
+        sbePosition(lengthPosition + lengthOfLengthField);
+        std::memcpy(m_buffer + lengthPosition, &lengthFieldValue,
+                    sizeof(std::uint16_t));
+        if (length != std::uint16_t(0)) {
+            std::uint64_t pos = sbePosition();
+            sbePosition(pos + length);
+            std::memcpy(m_buffer + pos, src, length);
+        }
+        return *this;
+    }
+
+    std::string getNameAsString() {
+        std::uint64_t lengthOfLengthField = 2;
+        std::uint64_t lengthPosition = sbePosition();
+        sbePosition(lengthPosition + lengthOfLengthField);
+        std::uint16_t lengthFieldValue;
+        std::memcpy(&lengthFieldValue, m_buffer + lengthPosition,
+                    sizeof(std::uint16_t));
+        std::uint64_t dataLength =
+            SBE_LITTLE_ENDIAN_ENCODE_16(lengthFieldValue);
+        std::uint64_t pos = sbePosition();
+        const std::string result(m_buffer + pos, dataLength);
+        sbePosition(pos + dataLength);
+        return result;
+    }
+
+#ifdef SBE_USE_STRING_VIEW
+    std::string_view getNameAsStringView() {
+        std::uint64_t lengthOfLengthField = 2;
+        std::uint64_t lengthPosition = sbePosition();
+        sbePosition(lengthPosition + lengthOfLengthField);
+        std::uint16_t lengthFieldValue;
+        std::memcpy(&lengthFieldValue, m_buffer + lengthPosition,
+                    sizeof(std::uint16_t));
+        std::uint64_t dataLength =
+            SBE_LITTLE_ENDIAN_ENCODE_16(lengthFieldValue);
+        std::uint64_t pos = sbePosition();
+        const std::string_view result(m_buffer + pos, dataLength);
+        sbePosition(pos + dataLength);
+        return result;
+    }
+
+    CompactIdentityMessage &putName(const std::string_view str) {
+        if (str.length() > 1024) {
+            throw std::runtime_error("std::string too long for length type [E109]");
+        }
+        return putName(str.data(), static_cast<std::uint16_t>(str.length()));
+    }
+#else
+    CompactIdentityMessage &putName(const std::string &str) {
+        if (str.length() > 1024) {
+            throw std::runtime_error("std::string too long for length type [E109]");
+        }
+        return putName(str.data(), static_cast<std::uint16_t>(str.length()));
+    }
+#endif
+
+    SBE_NODISCARD static const char *addressMetaAttribute(
+        const MetaAttribute metaAttribute) SBE_NOEXCEPT {
+        switch (metaAttribute) {
+            case MetaAttribute::PRESENCE:
+                return "required";
+            default:
+                return "";
+        }
+    }
+
+    static const char *addressCharacterEncoding() SBE_NOEXCEPT {
+        return "UTF-8";
+    }
+
+    SBE_NODISCARD static SBE_CONSTEXPR std::uint64_t addressSinceVersion()
+        SBE_NOEXCEPT {
+        return 0;
+    }
+
+    bool addressInActingVersion() SBE_NOEXCEPT { return true; }
+
+    static SBE_CONSTEXPR std::uint16_t addressId() SBE_NOEXCEPT { return 8; }
+
+    static SBE_CONSTEXPR std::uint64_t addressHeaderLength() SBE_NOEXCEPT {
+        return 2;
+    }
+
+    SBE_NODISCARD std::uint16_t addressLength() const {
+        std::uint16_t length;
+        std::memcpy(&length, m_buffer + sbePosition(), sizeof(std::uint16_t));
+        return SBE_LITTLE_ENDIAN_ENCODE_16(length);
+    }
+
+    std::uint64_t skipAddress() {
+        std::uint64_t lengthOfLengthField = 2;
+        std::uint64_t lengthPosition = sbePosition();
+        std::uint16_t lengthFieldValue;
+        std::memcpy(&lengthFieldValue, m_buffer + lengthPosition,
+                    sizeof(std::uint16_t));
+        std::uint64_t dataLength =
+            SBE_LITTLE_ENDIAN_ENCODE_16(lengthFieldValue);
+        sbePosition(lengthPosition + lengthOfLengthField + dataLength);
+        return dataLength;
+    }
+
+    SBE_NODISCARD const char *address() {
+        std::uint16_t lengthFieldValue;
+        std::memcpy(&lengthFieldValue, m_buffer + sbePosition(),
+                    sizeof(std::uint16_t));
+        const char *fieldPtr = m_buffer + sbePosition() + 2;
+        sbePosition(sbePosition() + 2 +
+                    SBE_LITTLE_ENDIAN_ENCODE_16(lengthFieldValue));
+        return fieldPtr;
+    }
+
+    std::uint64_t getAddress(char *dst, const std::uint64_t length) {
+        std::uint64_t lengthOfLengthField = 2;
+        std::uint64_t lengthPosition = sbePosition();
+        sbePosition(lengthPosition + lengthOfLengthField);
+        std::uint16_t lengthFieldValue;
+        std::memcpy(&lengthFieldValue, m_buffer + lengthPosition,
+                    sizeof(std::uint16_t));
+        std::uint64_t dataLength =
+            SBE_LITTLE_ENDIAN_ENCODE_16(lengthFieldValue);
+        std::uint64_t bytesToCopy = length < dataLength ? length : dataLength;
+        std::uint64_t pos = sbePosition();
+        sbePosition(pos + dataLength);
+        std::memcpy(dst, m_buffer + pos, static_cast<std::size_t>(bytesToCopy));
+        return bytesToCopy;
+    }
+
+    CompactIdentityMessage &putAddress(const char *src,
+                                     const std::uint16_t length) {
+        std::uint64_t lengthOfLengthField = 2;
+        std::uint64_t lengthPosition = sbePosition();
+        std::uint16_t lengthFieldValue = SBE_LITTLE_ENDIAN_ENCODE_16(length);
+        sbePosition(lengthPosition + lengthOfLengthField);
+        std::memcpy(m_buffer + lengthPosition, &lengthFieldValue,
+                    sizeof(std::uint16_t));
+        if (length != std::uint16_t(0)) {
+            std::uint64_t pos = sbePosition();
+            sbePosition(pos + length);
+            std::memcpy(m_buffer + pos, src, length);
+        }
+        return *this;
+    }
+
+    std::string getAddressAsString() {
+        std::uint64_t lengthOfLengthField = 2;
+        std::uint64_t lengthPosition = sbePosition();
+        sbePosition(lengthPosition + lengthOfLengthField);
+        std::uint16_t lengthFieldValue;
+        std::memcpy(&lengthFieldValue, m_buffer + lengthPosition,
+                    sizeof(std::uint16_t));
+        std::uint64_t dataLength =
+            SBE_LITTLE_ENDIAN_ENCODE_16(lengthFieldValue);
+        std::uint64_t pos = sbePosition();
+        const std::string result(m_buffer + pos, dataLength);
+        sbePosition(pos + dataLength);
+        return result;
+    }
+
+#ifdef SBE_USE_STRING_VIEW
+    std::string_view getAddressAsStringView() {
+        std::uint64_t lengthOfLengthField = 2;
+        std::uint64_t lengthPosition = sbePosition();
+        sbePosition(lengthPosition + lengthOfLengthField);
+        std::uint16_t lengthFieldValue;
+        std::memcpy(&lengthFieldValue, m_buffer + lengthPosition,
+                    sizeof(std::uint16_t));
+        std::uint64_t dataLength =
+            SBE_LITTLE_ENDIAN_ENCODE_16(lengthFieldValue);
+        std::uint64_t pos = sbePosition();
+        const std::string_view result(m_buffer + pos, dataLength);
+        sbePosition(pos + dataLength);
+        return result;
+    }
+
+    CompactIdentityMessage &putAddress(const std::string_view str) {
+        if (str.length() > 1024) {
+            throw std::runtime_error("std::string too long for length type [E109]");
+        }
+        return putAddress(str.data(), static_cast<std::uint16_t>(str.length()));
+    }
+#else
+    CompactIdentityMessage &putAddress(const std::string &str) {
+        if (str.length() > 1024) {
+            throw std::runtime_error("std::string too long for length type [E109]");
+        }
+        return putAddress(str.data(), static_cast<std::uint16_t>(str.length()));
+    }
+#endif
+
+    template <typename CharT, typename Traits>
+    friend std::basic_ostream<CharT, Traits> &operator<<(
+        std::basic_ostream<CharT, Traits> &builder,
+        const CompactIdentityMessage &_writer) {
+        CompactIdentityMessage writer(
+            _writer.m_buffer, _writer.m_offset, _writer.m_bufferLength,
+            _writer.m_actingBlockLength, _writer.m_actingVersion);
+
+        builder << '{';
+        builder << R"("Name": "CompactIdentityMessage", )";
+        builder << R"("sbeTemplateId": )";
+        builder << writer.sbeTemplateId();
+        builder << ", ";
+
+        builder << R"("kind": )";
+        builder << '"' << writer.kind() << '"';
+
+        builder << ", ";
+        builder << R"("isVerified": )";
+        builder << '"' << writer.isVerified() << '"';
+
+        builder << ", ";
+        builder << R"("type": )";
+        builder << '"' << writer.type() << '"';
+
+        builder << ", ";
+        builder << R"("id": )";
+        builder << '"' << writer.getIdAsString() << '"';
+
+        builder << ", ";
+        builder << R"("dateOfIssue": )";
+        builder << +writer.dateOfIssue();
+
+        builder << ", ";
+        builder << R"("dateOfExpiry": )";
+        builder << +writer.dateOfExpiry();
+
+        builder << ", ";
+        builder << R"("correlationId": )";
+        builder << +writer.correlationId();
+
+        builder << ", ";
+        builder << R"("clientSendTimeNs": )";
+        builder << +writer.clientSendTimeNs();
+
+        builder << ", ";
+        builder << R"("engineReceiveTimeNs": )";
+        builder << +writer.engineReceiveTimeNs();
+
+        builder << ", ";
+        builder << R"("engineSendTimeNs": )";
+        builder << +writer.engineSendTimeNs();
+
+        builder << ", ";
+        builder << R"("name": )";
+        builder << '"' << writer.getNameAsString() << '"';
+
+        builder << ", ";
+        builder << R"("address": )";
+        builder << '"' << writer.getAddressAsString() << '"';
+
+        builder << '}';
+
+        return builder;
+    }
+
+    void skip() {
+        skipName();
+        skipAddress();
+    }
+
+    SBE_NODISCARD static SBE_CONSTEXPR bool isConstLength() SBE_NOEXCEPT {
+        return false;
+    }
+
+    SBE_NODISCARD static std::size_t computeLength(std::size_t nameLength = 0,
+                                                   std::size_t addressLength = 0) {
+#if defined(__GNUG__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wtype-limits"
+#endif
+        std::size_t length = sbeBlockLength();
+
+        length += nameHeaderLength();
+        if (nameLength > 1024LL) {
+            throw std::runtime_error("nameLength too long for length type [E109]");
+        }
+        length += nameLength;
+
+        length += addressHeaderLength();
+        if (addressLength > 1024LL) {
+            throw std::runtime_error("addressLength too long for length type [E109]");
+        }
+        length += addressLength;
+
+        return length;
+#if defined(__GNUG__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+    }
+};
+}  // namespace messages
+
+#endif
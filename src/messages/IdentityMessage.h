@@ -90,8 +90,10 @@
 #define SBE_NULLVALUE_UINT32 (std::numeric_limits<std::uint32_t>::max)()
 #define SBE_NULLVALUE_UINT64 (std::numeric_limits<std::uint64_t>::max)()
 
+#include "BooleanType.h"
 #include "Char64str.h"
 #include "MessageHeader.h"
+#include "MessageKind.h"
 
 namespace messages {
 
@@ -108,14 +110,14 @@ class IdentityMessage {
 
    public:
     static constexpr std::uint16_t SBE_BLOCK_LENGTH =
-        static_cast<std::uint16_t>(512);
+        static_cast<std::uint16_t>(546);
     static constexpr std::uint16_t SBE_TEMPLATE_ID =
         static_cast<std::uint16_t>(1);
     static constexpr std::uint16_t SBE_SCHEMA_ID =
         static_cast<std::uint16_t>(1);
     static constexpr std::uint16_t SBE_SCHEMA_VERSION =
-        static_cast<std::uint16_t>(1);
-    static constexpr const char *SBE_SEMANTIC_VERSION = "1.0.0";
+        static_cast<std::uint16_t>(5);
+    static constexpr const char *SBE_SEMANTIC_VERSION = "1.4.0";
 
     enum MetaAttribute { EPOCH, TIME_UNIT, SEMANTIC_TYPE, PRESENCE };
 
@@ -156,7 +158,7 @@ class IdentityMessage {
 
     SBE_NODISCARD static SBE_CONSTEXPR std::uint16_t sbeBlockLength()
         SBE_NOEXCEPT {
-        return static_cast<std::uint16_t>(512);
+        return static_cast<std::uint16_t>(546);
     }
 
     SBE_NODISCARD static SBE_CONSTEXPR std::uint64_t sbeBlockAndHeaderLength()
@@ -176,11 +178,11 @@ class IdentityMessage {
 
     SBE_NODISCARD static SBE_CONSTEXPR std::uint16_t sbeSchemaVersion()
         SBE_NOEXCEPT {
-        return static_cast<std::uint16_t>(1);
+        return static_cast<std::uint16_t>(5);
     }
 
     SBE_NODISCARD static const char *sbeSemanticVersion() SBE_NOEXCEPT {
-        return "1.0.0";
+        return "1.4.0";
     }
 
     SBE_NODISCARD static SBE_CONSTEXPR const char *sbeSemanticType()
@@ -553,6 +555,350 @@ class IdentityMessage {
         return m_verified;
     }
 
+    SBE_NODISCARD static const char *kindMetaAttribute(
+        const MetaAttribute metaAttribute) SBE_NOEXCEPT {
+        switch (metaAttribute) {
+            case MetaAttribute::PRESENCE:
+                return "required";
+            default:
+                return "";
+        }
+    }
+
+    static SBE_CONSTEXPR std::uint16_t kindId() SBE_NOEXCEPT { return 9; }
+
+    SBE_NODISCARD static SBE_CONSTEXPR std::uint64_t kindSinceVersion()
+        SBE_NOEXCEPT {
+        return 2;
+    }
+
+    SBE_NODISCARD bool kindInActingVersion() SBE_NOEXCEPT {
+        return m_actingVersion >= kindSinceVersion();
+    }
+
+    SBE_NODISCARD static SBE_CONSTEXPR std::size_t kindEncodingOffset()
+        SBE_NOEXCEPT {
+        return 512;
+    }
+
+    SBE_NODISCARD static SBE_CONSTEXPR std::size_t kindEncodingLength()
+        SBE_NOEXCEPT {
+        return 1;
+    }
+
+    SBE_NODISCARD std::uint8_t kindRaw() const SBE_NOEXCEPT {
+        std::uint8_t val;
+        std::memcpy(&val, m_buffer + m_offset + 512, sizeof(std::uint8_t));
+        return (val);
+    }
+
+    SBE_NODISCARD MessageKind::Value kind() const {
+        if (m_actingVersion < 2) {
+            return MessageKind::NULL_VALUE;
+        }
+
+        std::uint8_t val;
+        std::memcpy(&val, m_buffer + m_offset + 512, sizeof(std::uint8_t));
+        return MessageKind::get((val));
+    }
+
+    IdentityMessage &kind(const MessageKind::Value value) SBE_NOEXCEPT {
+        std::uint8_t val = (value);
+        std::memcpy(m_buffer + m_offset + 512, &val, sizeof(std::uint8_t));
+        return *this;
+    }
+
+    SBE_NODISCARD static const char *isVerifiedMetaAttribute(
+        const MetaAttribute metaAttribute) SBE_NOEXCEPT {
+        switch (metaAttribute) {
+            case MetaAttribute::PRESENCE:
+                return "required";
+            default:
+                return "";
+        }
+    }
+
+    static SBE_CONSTEXPR std::uint16_t isVerifiedId() SBE_NOEXCEPT {
+        return 10;
+    }
+
+    SBE_NODISCARD static SBE_CONSTEXPR std::uint64_t isVerifiedSinceVersion()
+        SBE_NOEXCEPT {
+        return 2;
+    }
+
+    SBE_NODISCARD bool isVerifiedInActingVersion() SBE_NOEXCEPT {
+        return m_actingVersion >= isVerifiedSinceVersion();
+    }
+
+    SBE_NODISCARD static SBE_CONSTEXPR std::size_t isVerifiedEncodingOffset()
+        SBE_NOEXCEPT {
+        return 513;
+    }
+
+    SBE_NODISCARD static SBE_CONSTEXPR std::size_t isVerifiedEncodingLength()
+        SBE_NOEXCEPT {
+        return 1;
+    }
+
+    SBE_NODISCARD std::uint8_t isVerifiedRaw() const SBE_NOEXCEPT {
+        std::uint8_t val;
+        std::memcpy(&val, m_buffer + m_offset + 513, sizeof(std::uint8_t));
+        return (val);
+    }
+
+    SBE_NODISCARD BooleanType::Value isVerified() const {
+        if (m_actingVersion < 2) {
+            return BooleanType::NULL_VALUE;
+        }
+
+        std::uint8_t val;
+        std::memcpy(&val, m_buffer + m_offset + 513, sizeof(std::uint8_t));
+        return BooleanType::get((val));
+    }
+
+    IdentityMessage &isVerified(const BooleanType::Value value) SBE_NOEXCEPT {
+        std::uint8_t val = (value);
+        std::memcpy(m_buffer + m_offset + 513, &val, sizeof(std::uint8_t));
+        return *this;
+    }
+
+    SBE_NODISCARD static const char *correlationIdMetaAttribute(
+        const MetaAttribute metaAttribute) SBE_NOEXCEPT {
+        switch (metaAttribute) {
+            case MetaAttribute::PRESENCE:
+                return "required";
+            default:
+                return "";
+        }
+    }
+
+    static SBE_CONSTEXPR std::uint16_t correlationIdId() SBE_NOEXCEPT { return 11; }
+
+    SBE_NODISCARD static SBE_CONSTEXPR std::uint64_t correlationIdSinceVersion()
+        SBE_NOEXCEPT {
+        return 5;
+    }
+
+    SBE_NODISCARD bool correlationIdInActingVersion() SBE_NOEXCEPT {
+        return m_actingVersion >= correlationIdSinceVersion();
+    }
+
+    SBE_NODISCARD static SBE_CONSTEXPR std::size_t correlationIdEncodingOffset()
+        SBE_NOEXCEPT {
+        return 514;
+    }
+
+    SBE_NODISCARD static SBE_CONSTEXPR std::size_t correlationIdEncodingLength()
+        SBE_NOEXCEPT {
+        return 8;
+    }
+
+    static SBE_CONSTEXPR std::uint64_t correlationIdNullValue() SBE_NOEXCEPT {
+        return SBE_NULLVALUE_UINT64;
+    }
+
+    static SBE_CONSTEXPR std::uint64_t correlationIdMinValue() SBE_NOEXCEPT {
+        return UINT64_C(0x0);
+    }
+
+    static SBE_CONSTEXPR std::uint64_t correlationIdMaxValue() SBE_NOEXCEPT {
+        return UINT64_C(0xfffffffffffffffe);
+    }
+
+    SBE_NODISCARD std::uint64_t correlationId() const SBE_NOEXCEPT {
+        if (m_actingVersion < 5) {
+            return SBE_NULLVALUE_UINT64;
+        }
+
+        std::uint64_t val;
+        std::memcpy(&val, m_buffer + m_offset + 514, sizeof(std::uint64_t));
+        return SBE_LITTLE_ENDIAN_ENCODE_64(val);
+    }
+
+    IdentityMessage &correlationId(const std::uint64_t value) SBE_NOEXCEPT {
+        std::uint64_t val = SBE_LITTLE_ENDIAN_ENCODE_64(value);
+        std::memcpy(m_buffer + m_offset + 514, &val, sizeof(std::uint64_t));
+        return *this;
+    }
+
+    SBE_NODISCARD static const char *clientSendTimeNsMetaAttribute(
+        const MetaAttribute metaAttribute) SBE_NOEXCEPT {
+        switch (metaAttribute) {
+            case MetaAttribute::PRESENCE:
+                return "required";
+            default:
+                return "";
+        }
+    }
+
+    static SBE_CONSTEXPR std::uint16_t clientSendTimeNsId() SBE_NOEXCEPT { return 12; }
+
+    SBE_NODISCARD static SBE_CONSTEXPR std::uint64_t clientSendTimeNsSinceVersion()
+        SBE_NOEXCEPT {
+        return 5;
+    }
+
+    SBE_NODISCARD bool clientSendTimeNsInActingVersion() SBE_NOEXCEPT {
+        return m_actingVersion >= clientSendTimeNsSinceVersion();
+    }
+
+    SBE_NODISCARD static SBE_CONSTEXPR std::size_t clientSendTimeNsEncodingOffset()
+        SBE_NOEXCEPT {
+        return 522;
+    }
+
+    SBE_NODISCARD static SBE_CONSTEXPR std::size_t clientSendTimeNsEncodingLength()
+        SBE_NOEXCEPT {
+        return 8;
+    }
+
+    static SBE_CONSTEXPR std::uint64_t clientSendTimeNsNullValue() SBE_NOEXCEPT {
+        return SBE_NULLVALUE_UINT64;
+    }
+
+    static SBE_CONSTEXPR std::uint64_t clientSendTimeNsMinValue() SBE_NOEXCEPT {
+        return UINT64_C(0x0);
+    }
+
+    static SBE_CONSTEXPR std::uint64_t clientSendTimeNsMaxValue() SBE_NOEXCEPT {
+        return UINT64_C(0xfffffffffffffffe);
+    }
+
+    SBE_NODISCARD std::uint64_t clientSendTimeNs() const SBE_NOEXCEPT {
+        if (m_actingVersion < 5) {
+            return SBE_NULLVALUE_UINT64;
+        }
+
+        std::uint64_t val;
+        std::memcpy(&val, m_buffer + m_offset + 522, sizeof(std::uint64_t));
+        return SBE_LITTLE_ENDIAN_ENCODE_64(val);
+    }
+
+    IdentityMessage &clientSendTimeNs(const std::uint64_t value) SBE_NOEXCEPT {
+        std::uint64_t val = SBE_LITTLE_ENDIAN_ENCODE_64(value);
+        std::memcpy(m_buffer + m_offset + 522, &val, sizeof(std::uint64_t));
+        return *this;
+    }
+
+    SBE_NODISCARD static const char *engineReceiveTimeNsMetaAttribute(
+        const MetaAttribute metaAttribute) SBE_NOEXCEPT {
+        switch (metaAttribute) {
+            case MetaAttribute::PRESENCE:
+                return "required";
+            default:
+                return "";
+        }
+    }
+
+    static SBE_CONSTEXPR std::uint16_t engineReceiveTimeNsId() SBE_NOEXCEPT { return 13; }
+
+    SBE_NODISCARD static SBE_CONSTEXPR std::uint64_t engineReceiveTimeNsSinceVersion()
+        SBE_NOEXCEPT {
+        return 5;
+    }
+
+    SBE_NODISCARD bool engineReceiveTimeNsInActingVersion() SBE_NOEXCEPT {
+        return m_actingVersion >= engineReceiveTimeNsSinceVersion();
+    }
+
+    SBE_NODISCARD static SBE_CONSTEXPR std::size_t engineReceiveTimeNsEncodingOffset()
+        SBE_NOEXCEPT {
+        return 530;
+    }
+
+    SBE_NODISCARD static SBE_CONSTEXPR std::size_t engineReceiveTimeNsEncodingLength()
+        SBE_NOEXCEPT {
+        return 8;
+    }
+
+    static SBE_CONSTEXPR std::uint64_t engineReceiveTimeNsNullValue() SBE_NOEXCEPT {
+        return SBE_NULLVALUE_UINT64;
+    }
+
+    static SBE_CONSTEXPR std::uint64_t engineReceiveTimeNsMinValue() SBE_NOEXCEPT {
+        return UINT64_C(0x0);
+    }
+
+    static SBE_CONSTEXPR std::uint64_t engineReceiveTimeNsMaxValue() SBE_NOEXCEPT {
+        return UINT64_C(0xfffffffffffffffe);
+    }
+
+    SBE_NODISCARD std::uint64_t engineReceiveTimeNs() const SBE_NOEXCEPT {
+        if (m_actingVersion < 5) {
+            return SBE_NULLVALUE_UINT64;
+        }
+
+        std::uint64_t val;
+        std::memcpy(&val, m_buffer + m_offset + 530, sizeof(std::uint64_t));
+        return SBE_LITTLE_ENDIAN_ENCODE_64(val);
+    }
+
+    IdentityMessage &engineReceiveTimeNs(const std::uint64_t value) SBE_NOEXCEPT {
+        std::uint64_t val = SBE_LITTLE_ENDIAN_ENCODE_64(value);
+        std::memcpy(m_buffer + m_offset + 530, &val, sizeof(std::uint64_t));
+        return *this;
+    }
+
+    SBE_NODISCARD static const char *engineSendTimeNsMetaAttribute(
+        const MetaAttribute metaAttribute) SBE_NOEXCEPT {
+        switch (metaAttribute) {
+            case MetaAttribute::PRESENCE:
+                return "required";
+            default:
+                return "";
+        }
+    }
+
+    static SBE_CONSTEXPR std::uint16_t engineSendTimeNsId() SBE_NOEXCEPT { return 14; }
+
+    SBE_NODISCARD static SBE_CONSTEXPR std::uint64_t engineSendTimeNsSinceVersion()
+        SBE_NOEXCEPT {
+        return 5;
+    }
+
+    SBE_NODISCARD bool engineSendTimeNsInActingVersion() SBE_NOEXCEPT {
+        return m_actingVersion >= engineSendTimeNsSinceVersion();
+    }
+
+    SBE_NODISCARD static SBE_CONSTEXPR std::size_t engineSendTimeNsEncodingOffset()
+        SBE_NOEXCEPT {
+        return 538;
+    }
+
+    SBE_NODISCARD static SBE_CONSTEXPR std::size_t engineSendTimeNsEncodingLength()
+        SBE_NOEXCEPT {
+        return 8;
+    }
+
+    static SBE_CONSTEXPR std::uint64_t engineSendTimeNsNullValue() SBE_NOEXCEPT {
+        return SBE_NULLVALUE_UINT64;
+    }
+
+    static SBE_CONSTEXPR std::uint64_t engineSendTimeNsMinValue() SBE_NOEXCEPT {
+        return UINT64_C(0x0);
+    }
+
+    static SBE_CONSTEXPR std::uint64_t engineSendTimeNsMaxValue() SBE_NOEXCEPT {
+        return UINT64_C(0xfffffffffffffffe);
+    }
+
+    SBE_NODISCARD std::uint64_t engineSendTimeNs() const SBE_NOEXCEPT {
+        if (m_actingVersion < 5) {
+            return SBE_NULLVALUE_UINT64;
+        }
+
+        std::uint64_t val;
+        std::memcpy(&val, m_buffer + m_offset + 538, sizeof(std::uint64_t));
+        return SBE_LITTLE_ENDIAN_ENCODE_64(val);
+    }
+
+    IdentityMessage &engineSendTimeNs(const std::uint64_t value) SBE_NOEXCEPT {
+        std::uint64_t val = SBE_LITTLE_ENDIAN_ENCODE_64(value);
+        std::memcpy(m_buffer + m_offset + 538, &val, sizeof(std::uint64_t));
+        return *this;
+    }
+
     template <typename CharT, typename Traits>
     friend std::basic_ostream<CharT, Traits> &operator<<(
         std::basic_ostream<CharT, Traits> &builder,
@@ -598,6 +944,30 @@ class IdentityMessage {
         builder << R"("verified": )";
         builder << writer.verified();
 
+        builder << ", ";
+        builder << R"("kind": )";
+        builder << '"' << writer.kind() << '"';
+
+        builder << ", ";
+        builder << R"("isVerified": )";
+        builder << '"' << writer.isVerified() << '"';
+
+        builder << ", ";
+        builder << R"("correlationId": )";
+        builder << +writer.correlationId();
+
+        builder << ", ";
+        builder << R"("clientSendTimeNs": )";
+        builder << +writer.clientSendTimeNs();
+
+        builder << ", ";
+        builder << R"("engineReceiveTimeNs": )";
+        builder << +writer.engineReceiveTimeNs();
+
+        builder << ", ";
+        builder << R"("engineSendTimeNs": )";
+        builder << +writer.engineSendTimeNs();
+
         builder << '}';
 
         return builder;
@@ -0,0 +1,792 @@
+/* Generated SBE (Simple Binary Encoding) message codec */
+#ifndef _MY_APP_MESSAGES_VERIFYBATCHREQUEST_CXX_H_
+#define _MY_APP_MESSAGES_VERIFYBATCHREQUEST_CXX_H_
+
+#if __cplusplus >= 201103L
+#define SBE_CONSTEXPR constexpr
+#define SBE_NOEXCEPT noexcept
+#else
+#define SBE_CONSTEXPR
+#define SBE_NOEXCEPT
+#endif
+
+#if __cplusplus >= 201703L
+#include <string_view>
+#define SBE_NODISCARD [[nodiscard]]
+#if !defined(SBE_USE_STRING_VIEW)
+#define SBE_USE_STRING_VIEW 1
+#endif
+#else
+#define SBE_NODISCARD
+#endif
+
+#if __cplusplus >= 202002L
+#include <span>
+#if !defined(SBE_USE_SPAN)
+#define SBE_USE_SPAN 1
+#endif
+#endif
+
+#if !defined(__STDC_LIMIT_MACROS)
+#define __STDC_LIMIT_MACROS 1
+#endif
+
+#include <cstdint>
+#include <cstring>
+#include <iomanip>
+#include <limits>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#if defined(WIN32) || defined(_WIN32)
+#define SBE_BIG_ENDIAN_ENCODE_16(v) _byteswap_ushort(v)
+#define SBE_BIG_ENDIAN_ENCODE_32(v) _byteswap_ulong(v)
+#define SBE_BIG_ENDIAN_ENCODE_64(v) _byteswap_uint64(v)
+#define SBE_LITTLE_ENDIAN_ENCODE_16(v) (v)
+#define SBE_LITTLE_ENDIAN_ENCODE_32(v) (v)
+#define SBE_LITTLE_ENDIAN_ENCODE_64(v) (v)
+#elif __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define SBE_BIG_ENDIAN_ENCODE_16(v) __builtin_bswap16(v)
+#define SBE_BIG_ENDIAN_ENCODE_32(v) __builtin_bswap32(v)
+#define SBE_BIG_ENDIAN_ENCODE_64(v) __builtin_bswap64(v)
+#define SBE_LITTLE_ENDIAN_ENCODE_16(v) (v)
+#define SBE_LITTLE_ENDIAN_ENCODE_32(v) (v)
+#define SBE_LITTLE_ENDIAN_ENCODE_64(v) (v)
+#elif __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#define SBE_LITTLE_ENDIAN_ENCODE_16(v) __builtin_bswap16(v)
+#define SBE_LITTLE_ENDIAN_ENCODE_32(v) __builtin_bswap32(v)
+#define SBE_LITTLE_ENDIAN_ENCODE_64(v) __builtin_bswap64(v)
+#define SBE_BIG_ENDIAN_ENCODE_16(v) (v)
+#define SBE_BIG_ENDIAN_ENCODE_32(v) (v)
+#define SBE_BIG_ENDIAN_ENCODE_64(v) (v)
+#else
+#error \
+    "Byte Ordering of platform not determined. Set __BYTE_ORDER__ manually before including this file."
+#endif
+
+#if !defined(SBE_BOUNDS_CHECK_EXPECT)
+#if defined(SBE_NO_BOUNDS_CHECK)
+#define SBE_BOUNDS_CHECK_EXPECT(exp, c) (false)
+#elif defined(_MSC_VER)
+#define SBE_BOUNDS_CHECK_EXPECT(exp, c) (exp)
+#else
+#define SBE_BOUNDS_CHECK_EXPECT(exp, c) (__builtin_expect(exp, c))
+#endif
+
+#endif
+
+#define SBE_FLOAT_NAN std::numeric_limits<float>::quiet_NaN()
+#define SBE_DOUBLE_NAN std::numeric_limits<double>::quiet_NaN()
+#define SBE_NULLVALUE_INT8 (std::numeric_limits<std::int8_t>::min)()
+#define SBE_NULLVALUE_INT16 (std::numeric_limits<std::int16_t>::min)()
+#define SBE_NULLVALUE_INT32 (std::numeric_limits<std::int32_t>::min)()
+#define SBE_NULLVALUE_INT64 (std::numeric_limits<std::int64_t>::min)()
+#define SBE_NULLVALUE_UINT8 (std::numeric_limits<std::uint8_t>::max)()
+#define SBE_NULLVALUE_UINT16 (std::numeric_limits<std::uint16_t>::max)()
+#define SBE_NULLVALUE_UINT32 (std::numeric_limits<std::uint32_t>::max)()
+#define SBE_NULLVALUE_UINT64 (std::numeric_limits<std::uint64_t>::max)()
+
+#include "GroupSizeEncoding.h"
+#include "MessageHeader.h"
+#include "VarStringEncoding.h"
+
+namespace messages {
+
+class VerifyBatchRequest {
+   private:
+    char *m_buffer = nullptr;
+    std::uint64_t m_bufferLength = 0;
+    std::uint64_t m_offset = 0;
+    std::uint64_t m_position = 0;
+    std::uint64_t m_actingBlockLength = 0;
+    std::uint64_t m_actingVersion = 0;
+
+    inline std::uint64_t *sbePositionPtr() SBE_NOEXCEPT { return &m_position; }
+
+   public:
+    static constexpr std::uint16_t SBE_BLOCK_LENGTH =
+        static_cast<std::uint16_t>(8);
+    static constexpr std::uint16_t SBE_TEMPLATE_ID =
+        static_cast<std::uint16_t>(3);
+    static constexpr std::uint16_t SBE_SCHEMA_ID =
+        static_cast<std::uint16_t>(1);
+    static constexpr std::uint16_t SBE_SCHEMA_VERSION =
+        static_cast<std::uint16_t>(5);
+    static constexpr const char *SBE_SEMANTIC_VERSION = "1.4.0";
+
+    enum MetaAttribute { EPOCH, TIME_UNIT, SEMANTIC_TYPE, PRESENCE };
+
+    union sbe_float_as_uint_u {
+        float fp_value;
+        std::uint32_t uint_value;
+    };
+
+    union sbe_double_as_uint_u {
+        double fp_value;
+        std::uint64_t uint_value;
+    };
+
+    using messageHeader = MessageHeader;
+
+    VerifyBatchRequest() = default;
+
+    VerifyBatchRequest(char *buffer, const std::uint64_t offset,
+                    const std::uint64_t bufferLength,
+                    const std::uint64_t actingBlockLength,
+                    const std::uint64_t actingVersion)
+        : m_buffer(buffer),
+          m_bufferLength(bufferLength),
+          m_offset(offset),
+          m_position(sbeCheckPosition(offset + actingBlockLength)),
+          m_actingBlockLength(actingBlockLength),
+          m_actingVersion(actingVersion) {}
+
+    VerifyBatchRequest(char *buffer, const std::uint64_t bufferLength)
+        : VerifyBatchRequest(buffer, 0, bufferLength, sbeBlockLength(),
+                          sbeSchemaVersion()) {}
+
+    VerifyBatchRequest(char *buffer, const std::uint64_t bufferLength,
+                    const std::uint64_t actingBlockLength,
+                    const std::uint64_t actingVersion)
+        : VerifyBatchRequest(buffer, 0, bufferLength, actingBlockLength,
+                          actingVersion) {}
+
+    SBE_NODISCARD static SBE_CONSTEXPR std::uint16_t sbeBlockLength()
+        SBE_NOEXCEPT {
+        return static_cast<std::uint16_t>(8);
+    }
+
+    SBE_NODISCARD static SBE_CONSTEXPR std::uint64_t sbeBlockAndHeaderLength()
+        SBE_NOEXCEPT {
+        return messageHeader::encodedLength() + sbeBlockLength();
+    }
+
+    SBE_NODISCARD static SBE_CONSTEXPR std::uint16_t sbeTemplateId()
+        SBE_NOEXCEPT {
+        return static_cast<std::uint16_t>(3);
+    }
+
+    SBE_NODISCARD static SBE_CONSTEXPR std::uint16_t sbeSchemaId()
+        SBE_NOEXCEPT {
+        return static_cast<std::uint16_t>(1);
+    }
+
+    SBE_NODISCARD static SBE_CONSTEXPR std::uint16_t sbeSchemaVersion()
+        SBE_NOEXCEPT {
+        return static_cast<std::uint16_t>(5);
+    }
+
+    SBE_NODISCARD static const char *sbeSemanticVersion() SBE_NOEXCEPT {
+        return "1.4.0";
+    }
+
+    SBE_NODISCARD static SBE_CONSTEXPR const char *sbeSemanticType()
+        SBE_NOEXCEPT {
+        return "";
+    }
+
+    SBE_NODISCARD std::uint64_t offset() const SBE_NOEXCEPT { return m_offset; }
+
+    VerifyBatchRequest &wrapForEncode(char *buffer, const std::uint64_t offset,
+                                   const std::uint64_t bufferLength) {
+        m_buffer = buffer;
+        m_bufferLength = bufferLength;
+        m_offset = offset;
+        m_actingBlockLength = sbeBlockLength();
+        m_actingVersion = sbeSchemaVersion();
+        m_position = sbeCheckPosition(m_offset + m_actingBlockLength);
+        return *this;
+    }
+
+    VerifyBatchRequest &wrapAndApplyHeader(char *buffer,
+                                        const std::uint64_t offset,
+                                        const std::uint64_t bufferLength) {
+        messageHeader hdr(buffer, offset, bufferLength, sbeSchemaVersion());
+
+        hdr.blockLength(sbeBlockLength())
+            .templateId(sbeTemplateId())
+            .schemaId(sbeSchemaId())
+            .version(sbeSchemaVersion());
+
+        m_buffer = buffer;
+        m_bufferLength = bufferLength;
+        m_offset = offset + messageHeader::encodedLength();
+        m_actingBlockLength = sbeBlockLength();
+        m_actingVersion = sbeSchemaVersion();
+        m_position = sbeCheckPosition(m_offset + m_actingBlockLength);
+        return *this;
+    }
+
+    VerifyBatchRequest &wrapForDecode(char *buffer, const std::uint64_t offset,
+                                   const std::uint64_t actingBlockLength,
+                                   const std::uint64_t actingVersion,
+                                   const std::uint64_t bufferLength) {
+        m_buffer = buffer;
+        m_bufferLength = bufferLength;
+        m_offset = offset;
+        m_actingBlockLength = actingBlockLength;
+        m_actingVersion = actingVersion;
+        m_position = sbeCheckPosition(m_offset + m_actingBlockLength);
+        return *this;
+    }
+
+    VerifyBatchRequest &sbeRewind() {
+        return wrapForDecode(m_buffer, m_offset, m_actingBlockLength,
+                             m_actingVersion, m_bufferLength);
+    }
+
+    SBE_NODISCARD std::uint64_t sbePosition() const SBE_NOEXCEPT {
+        return m_position;
+    }
+
+    // NOLINTNEXTLINE(readability-convert-member-functions-to-static)
+    std::uint64_t sbeCheckPosition(const std::uint64_t position) {
+        if (SBE_BOUNDS_CHECK_EXPECT((position > m_bufferLength), false)) {
+            throw std::runtime_error("buffer too short [E100]");
+        }
+        return position;
+    }
+
+    void sbePosition(const std::uint64_t position) {
+        m_position = sbeCheckPosition(position);
+    }
+
+    SBE_NODISCARD std::uint64_t encodedLength() const SBE_NOEXCEPT {
+        return sbePosition() - m_offset;
+    }
+
+    SBE_NODISCARD std::uint64_t decodeLength() const {
+        VerifyBatchRequest skipper(m_buffer, m_offset, m_bufferLength,
+                                m_actingBlockLength, m_actingVersion);
+        skipper.skip();
+        return skipper.encodedLength();
+    }
+
+    SBE_NODISCARD const char *buffer() const SBE_NOEXCEPT { return m_buffer; }
+
+    SBE_NODISCARD char *buffer() SBE_NOEXCEPT { return m_buffer; }
+
+    SBE_NODISCARD std::uint64_t bufferLength() const SBE_NOEXCEPT {
+        return m_bufferLength;
+    }
+
+    SBE_NODISCARD std::uint64_t actingVersion() const SBE_NOEXCEPT {
+        return m_actingVersion;
+    }
+
+    SBE_NODISCARD static const char *batchIdMetaAttribute(
+        const MetaAttribute metaAttribute) SBE_NOEXCEPT {
+        switch (metaAttribute) {
+            case MetaAttribute::PRESENCE:
+                return "required";
+            default:
+                return "";
+        }
+    }
+
+    static SBE_CONSTEXPR std::uint16_t batchIdId() SBE_NOEXCEPT { return 1; }
+
+    SBE_NODISCARD static SBE_CONSTEXPR std::uint64_t batchIdSinceVersion()
+        SBE_NOEXCEPT {
+        return 0;
+    }
+
+    SBE_NODISCARD bool batchIdInActingVersion() SBE_NOEXCEPT { return true; }
+
+    SBE_NODISCARD static SBE_CONSTEXPR std::size_t batchIdEncodingOffset()
+        SBE_NOEXCEPT {
+        return 0;
+    }
+
+    SBE_NODISCARD static SBE_CONSTEXPR std::size_t batchIdEncodingLength()
+        SBE_NOEXCEPT {
+        return 8;
+    }
+
+    static SBE_CONSTEXPR std::uint64_t batchIdNullValue() SBE_NOEXCEPT {
+        return SBE_NULLVALUE_UINT64;
+    }
+
+    static SBE_CONSTEXPR std::uint64_t batchIdMinValue() SBE_NOEXCEPT {
+        return UINT64_C(0x0);
+    }
+
+    static SBE_CONSTEXPR std::uint64_t batchIdMaxValue() SBE_NOEXCEPT {
+        return UINT64_C(0xfffffffffffffffe);
+    }
+
+    SBE_NODISCARD std::uint64_t batchId() const SBE_NOEXCEPT {
+        std::uint64_t val;
+        std::memcpy(&val, m_buffer + m_offset + 0, sizeof(std::uint64_t));
+        return SBE_LITTLE_ENDIAN_ENCODE_64(val);
+    }
+
+    VerifyBatchRequest &batchId(const std::uint64_t value) SBE_NOEXCEPT {
+        std::uint64_t val = SBE_LITTLE_ENDIAN_ENCODE_64(value);
+        std::memcpy(m_buffer + m_offset + 0, &val, sizeof(std::uint64_t));
+        return *this;
+    }
+
+    class Entries {
+       private:
+        char *m_buffer = nullptr;
+        std::uint64_t m_bufferLength = 0;
+        std::uint64_t m_initialPosition = 0;
+        std::uint64_t *m_positionPtr = nullptr;
+        std::uint64_t m_blockLength = 0;
+        std::uint64_t m_count = 0;
+        std::uint64_t m_index = 0;
+        std::uint64_t m_offset = 0;
+        std::uint64_t m_actingVersion = 0;
+
+        SBE_NODISCARD std::uint64_t *sbePositionPtr() SBE_NOEXCEPT {
+            return m_positionPtr;
+        }
+
+       public:
+        Entries() = default;
+
+        inline void wrapForDecode(char *buffer, std::uint64_t *pos,
+                                  const std::uint64_t actingVersion,
+                                  const std::uint64_t bufferLength) {
+            GroupSizeEncoding dimensions(buffer, *pos, bufferLength,
+                                         actingVersion);
+            m_buffer = buffer;
+            m_bufferLength = bufferLength;
+            m_blockLength = dimensions.blockLength();
+            m_count = dimensions.numInGroup();
+            m_index = 0;
+            m_actingVersion = actingVersion;
+            m_initialPosition = *pos;
+            m_positionPtr = pos;
+            *m_positionPtr = *m_positionPtr + 4;
+        }
+
+        inline void wrapForEncode(char *buffer, const std::uint16_t count,
+                                  std::uint64_t *pos,
+                                  const std::uint64_t actingVersion,
+                                  const std::uint64_t bufferLength) {
+#if defined(__GNUG__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wtype-limits"
+#endif
+            if (count > 65534) {
+                throw std::runtime_error(
+                    "count outside of allowed range [E110]");
+            }
+#if defined(__GNUG__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+            m_buffer = buffer;
+            m_bufferLength = bufferLength;
+            GroupSizeEncoding dimensions(buffer, *pos, bufferLength,
+                                         actingVersion);
+            dimensions.blockLength(static_cast<std::uint16_t>(16));
+            dimensions.numInGroup(static_cast<std::uint16_t>(count));
+            m_index = 0;
+            m_count = count;
+            m_blockLength = 16;
+            m_actingVersion = actingVersion;
+            m_initialPosition = *pos;
+            m_positionPtr = pos;
+            *m_positionPtr = *m_positionPtr + 4;
+        }
+
+        static SBE_CONSTEXPR std::uint64_t sbeHeaderSize() SBE_NOEXCEPT {
+            return 4;
+        }
+
+        static SBE_CONSTEXPR std::uint64_t sbeBlockLength() SBE_NOEXCEPT {
+            return 16;
+        }
+
+        SBE_NODISCARD std::uint64_t sbeActingBlockLength() SBE_NOEXCEPT {
+            return m_blockLength;
+        }
+
+        SBE_NODISCARD std::uint64_t sbePosition() const SBE_NOEXCEPT {
+            return *m_positionPtr;
+        }
+
+        // NOLINTNEXTLINE(readability-convert-member-functions-to-static)
+        std::uint64_t sbeCheckPosition(const std::uint64_t position) {
+            if (SBE_BOUNDS_CHECK_EXPECT((position > m_bufferLength), false)) {
+                throw std::runtime_error("buffer too short [E100]");
+            }
+            return position;
+        }
+
+        void sbePosition(const std::uint64_t position) {
+            *m_positionPtr = sbeCheckPosition(position);
+        }
+
+        SBE_NODISCARD inline std::uint64_t count() const SBE_NOEXCEPT {
+            return m_count;
+        }
+
+        SBE_NODISCARD inline bool hasNext() const SBE_NOEXCEPT {
+            return m_index < m_count;
+        }
+
+        inline Entries &next() {
+            if (m_index >= m_count) {
+                throw std::runtime_error("index >= count [E108]");
+            }
+            m_offset = *m_positionPtr;
+            if (SBE_BOUNDS_CHECK_EXPECT(
+                    ((m_offset + m_blockLength) > m_bufferLength), false)) {
+                throw std::runtime_error(
+                    "buffer too short for next group index [E108]");
+            }
+            *m_positionPtr = m_offset + m_blockLength;
+            ++m_index;
+
+            return *this;
+        }
+
+        inline std::uint64_t resetCountToIndex() {
+            m_count = m_index;
+            GroupSizeEncoding dimensions(m_buffer, m_initialPosition,
+                                         m_bufferLength, m_actingVersion);
+            dimensions.numInGroup(static_cast<std::uint16_t>(m_count));
+            return m_count;
+        }
+
+        enum MetaAttribute { EPOCH, TIME_UNIT, SEMANTIC_TYPE, PRESENCE };
+
+        SBE_NODISCARD static const char *idMetaAttribute(
+            const MetaAttribute metaAttribute) SBE_NOEXCEPT {
+            switch (metaAttribute) {
+                case MetaAttribute::PRESENCE:
+                    return "required";
+                default:
+                    return "";
+            }
+        }
+
+        static SBE_CONSTEXPR std::uint16_t idId() SBE_NOEXCEPT { return 3; }
+
+        SBE_NODISCARD static SBE_CONSTEXPR std::uint64_t idSinceVersion()
+            SBE_NOEXCEPT {
+            return 0;
+        }
+
+        SBE_NODISCARD bool idInActingVersion() SBE_NOEXCEPT { return true; }
+
+        SBE_NODISCARD static SBE_CONSTEXPR std::size_t idEncodingOffset()
+            SBE_NOEXCEPT {
+            return 0;
+        }
+
+        SBE_NODISCARD static SBE_CONSTEXPR std::size_t idEncodingLength()
+            SBE_NOEXCEPT {
+            return 16;
+        }
+
+        static SBE_CONSTEXPR char idNullValue() SBE_NOEXCEPT {
+            return static_cast<char>(0);
+        }
+
+        static SBE_CONSTEXPR std::uint64_t idLength() SBE_NOEXCEPT {
+            return 16;
+        }
+
+        SBE_NODISCARD const char *id() const SBE_NOEXCEPT {
+            return m_buffer + m_offset + 0;
+        }
+
+        SBE_NODISCARD char *id() SBE_NOEXCEPT {
+            return m_buffer + m_offset + 0;
+        }
+
+        std::uint64_t getId(char *const dst, const std::uint64_t length) const {
+            if (length > 16) {
+                throw std::runtime_error("length too large for getId [E106]");
+            }
+
+            std::memcpy(dst, m_buffer + m_offset + 0,
+                        sizeof(char) * static_cast<std::size_t>(length));
+            return length;
+        }
+
+        SBE_NODISCARD std::string getIdAsString() const {
+            const char *buffer = m_buffer + m_offset + 0;
+            std::size_t length = 0;
+
+            for (; length < 16 && *(buffer + length) != '\0'; ++length);
+            std::string result(buffer, length);
+
+            return result;
+        }
+
+#ifdef SBE_USE_STRING_VIEW
+        SBE_NODISCARD std::string_view getIdAsStringView() const SBE_NOEXCEPT {
+            const char *buffer = m_buffer + m_offset + 0;
+            std::size_t length = 0;
+
+            for (; length < 16 && *(buffer + length) != '\0'; ++length);
+            std::string_view result(buffer, length);
+
+            return result;
+        }
+
+        Entries &putId(const std::string_view str) {
+            const std::size_t srcLength = str.length();
+            if (srcLength > 16) {
+                throw std::runtime_error("string too large for putId [E106]");
+            }
+
+            std::memcpy(m_buffer + m_offset + 0, str.data(), srcLength);
+            for (std::size_t start = srcLength; start < 16; ++start) {
+                m_buffer[m_offset + 0 + start] = 0;
+            }
+
+            return *this;
+        }
+#else
+        Entries &putId(const std::string &str) {
+            const std::size_t srcLength = str.length();
+            if (srcLength > 16) {
+                throw std::runtime_error("string too large for putId [E106]");
+            }
+
+            std::memcpy(m_buffer + m_offset + 0, str.c_str(), srcLength);
+            for (std::size_t start = srcLength; start < 16; ++start) {
+                m_buffer[m_offset + 0 + start] = 0;
+            }
+
+            return *this;
+        }
+#endif
+
+        SBE_NODISCARD static const char *nameMetaAttribute(
+            const MetaAttribute metaAttribute) SBE_NOEXCEPT {
+            switch (metaAttribute) {
+                case MetaAttribute::PRESENCE:
+                    return "required";
+                default:
+                    return "";
+            }
+        }
+
+        static const char *nameCharacterEncoding() SBE_NOEXCEPT {
+            return "UTF-8";
+        }
+
+        SBE_NODISCARD static SBE_CONSTEXPR std::uint64_t nameSinceVersion()
+            SBE_NOEXCEPT {
+            return 0;
+        }
+
+        bool nameInActingVersion() SBE_NOEXCEPT { return true; }
+
+        static SBE_CONSTEXPR std::uint16_t nameId() SBE_NOEXCEPT { return 4; }
+
+        static SBE_CONSTEXPR std::uint64_t nameHeaderLength() SBE_NOEXCEPT {
+            return 2;
+        }
+
+        SBE_NODISCARD std::uint16_t nameLength() const {
+            std::uint16_t length;
+            std::memcpy(&length, m_buffer + sbePosition(), sizeof(std::uint16_t));
+            return SBE_LITTLE_ENDIAN_ENCODE_16(length);
+        }
+
+        std::uint64_t skipName() {
+            std::uint64_t lengthOfLengthField = 2;
+            std::uint64_t lengthPosition = sbePosition();
+            std::uint16_t lengthFieldValue;
+            std::memcpy(&lengthFieldValue, m_buffer + lengthPosition,
+                        sizeof(std::uint16_t));
+            std::uint64_t dataLength =
+                SBE_LITTLE_ENDIAN_ENCODE_16(lengthFieldValue);
+            sbePosition(lengthPosition + lengthOfLengthField + dataLength);
+            return dataLength;
+        }
+
+        SBE_NODISCARD const char *name() {
+            std::uint16_t lengthFieldValue;
+            std::memcpy(&lengthFieldValue, m_buffer + sbePosition(),
+                        sizeof(std::uint16_t));
+            const char *fieldPtr = m_buffer + sbePosition() + 2;
+            sbePosition(sbePosition() + 2 +
+                        SBE_LITTLE_ENDIAN_ENCODE_16(lengthFieldValue));
+            return fieldPtr;
+        }
+
+        std::uint64_t getName(char *dst, const std::uint64_t length) {
+            std::uint64_t lengthOfLengthField = 2;
+            std::uint64_t lengthPosition = sbePosition();
+            sbePosition(lengthPosition + lengthOfLengthField);
+            std::uint16_t lengthFieldValue;
+            std::memcpy(&lengthFieldValue, m_buffer + lengthPosition,
+                        sizeof(std::uint16_t));
+            std::uint64_t dataLength =
+                SBE_LITTLE_ENDIAN_ENCODE_16(lengthFieldValue);
+            std::uint64_t bytesToCopy = length < dataLength ? length : dataLength;
+            std::uint64_t pos = sbePosition();
+            sbePosition(pos + dataLength);
+            std::memcpy(dst, m_buffer + pos, static_cast<std::size_t>(bytesToCopy));
+            return bytesToCopy;
+        }
+
+        Entries &putName(const char *src, const std::uint16_t length) {
+            std::uint64_t lengthOfLengthField = 2;
+            std::uint64_t lengthPosition = sbePosition();
+            std::uint16_t lengthFieldValue = SBE_LITTLE_ENDIAN_ENCODE_16(length);
+            sbePosition(lengthPosition + lengthOfLengthField);
+            std::memcpy(m_buffer + lengthPosition, &lengthFieldValue,
+                        sizeof(std::uint16_t));
+            if (length != std::uint16_t(0)) {
+                std::uint64_t pos = sbePosition();
+                sbePosition(pos + length);
+                std::memcpy(m_buffer + pos, src, length);
+            }
+            return *this;
+        }
+
+        std::string getNameAsString() {
+            std::uint64_t lengthOfLengthField = 2;
+            std::uint64_t lengthPosition = sbePosition();
+            sbePosition(lengthPosition + lengthOfLengthField);
+            std::uint16_t lengthFieldValue;
+            std::memcpy(&lengthFieldValue, m_buffer + lengthPosition,
+                        sizeof(std::uint16_t));
+            std::uint64_t dataLength =
+                SBE_LITTLE_ENDIAN_ENCODE_16(lengthFieldValue);
+            std::uint64_t pos = sbePosition();
+            const std::string result(m_buffer + pos, dataLength);
+            sbePosition(pos + dataLength);
+            return result;
+        }
+
+#ifdef SBE_USE_STRING_VIEW
+        std::string_view getNameAsStringView() {
+            std::uint64_t lengthOfLengthField = 2;
+            std::uint64_t lengthPosition = sbePosition();
+            sbePosition(lengthPosition + lengthOfLengthField);
+            std::uint16_t lengthFieldValue;
+            std::memcpy(&lengthFieldValue, m_buffer + lengthPosition,
+                        sizeof(std::uint16_t));
+            std::uint64_t dataLength =
+                SBE_LITTLE_ENDIAN_ENCODE_16(lengthFieldValue);
+            std::uint64_t pos = sbePosition();
+            const std::string_view result(m_buffer + pos, dataLength);
+            sbePosition(pos + dataLength);
+            return result;
+        }
+
+        Entries &putName(const std::string_view str) {
+            if (str.length() > 1024) {
+                throw std::runtime_error(
+                    "std::string too long for length type [E109]");
+            }
+            return putName(str.data(), static_cast<std::uint16_t>(str.length()));
+        }
+#else
+        Entries &putName(const std::string &str) {
+            if (str.length() > 1024) {
+                throw std::runtime_error(
+                    "std::string too long for length type [E109]");
+            }
+            return putName(str.data(), static_cast<std::uint16_t>(str.length()));
+        }
+#endif
+
+    void skip() { skipName(); }
+
+    SBE_NODISCARD static SBE_CONSTEXPR bool isConstLength() SBE_NOEXCEPT {
+        return false;
+    }
+    };
+
+   private:
+    Entries m_entries;
+
+   public:
+    SBE_NODISCARD static SBE_CONSTEXPR std::uint16_t entriesId() SBE_NOEXCEPT {
+        return 2;
+    }
+
+    SBE_NODISCARD inline Entries &entries() {
+        m_entries.wrapForDecode(m_buffer, sbePositionPtr(), m_actingVersion,
+                              m_bufferLength);
+        return m_entries;
+    }
+
+    Entries &entriesCount(const std::uint16_t count) {
+        m_entries.wrapForEncode(m_buffer, count, sbePositionPtr(),
+                              m_actingVersion, m_bufferLength);
+        return m_entries;
+    }
+
+    SBE_NODISCARD static SBE_CONSTEXPR std::uint64_t entriesSinceVersion()
+        SBE_NOEXCEPT {
+        return 0;
+    }
+
+    SBE_NODISCARD bool entriesInActingVersion() const SBE_NOEXCEPT {
+        return true;
+    }
+
+    template <typename CharT, typename Traits>
+    friend std::basic_ostream<CharT, Traits> &operator<<(
+        std::basic_ostream<CharT, Traits> &builder, const VerifyBatchRequest &_writer) {
+        VerifyBatchRequest writer(_writer.m_buffer, _writer.m_offset,
+                     _writer.m_bufferLength, _writer.m_actingBlockLength,
+                     _writer.m_actingVersion);
+
+        builder << '{';
+        builder << R"("Name": "VerifyBatchRequest", )";
+        builder << R"("sbeTemplateId": )";
+        builder << writer.sbeTemplateId();
+        builder << ", ";
+
+        builder << R"("batchId": )";
+        builder << +writer.batchId();
+
+        builder << ", ";
+        {
+            bool atLeastOne = false;
+            builder << R"("entries": [)";
+            auto &group = writer.entries();
+            while (group.hasNext()) {
+                if (atLeastOne) {
+                    builder << ", ";
+                }
+                atLeastOne = true;
+                group.next();
+                builder << '{';
+                builder << R"("id": )";
+                builder << '"' << group.getIdAsString() << '"';
+                builder << ", ";
+                builder << R"("name": )";
+                builder << '"' << group.getNameAsString() << '"';
+                builder << '}';
+            }
+            builder << ']';
+        }
+
+        builder << '}';
+
+        return builder;
+    }
+
+    void skip() {
+        auto &entriesGroup{entries()};
+        while (entriesGroup.hasNext()) {
+            entriesGroup.next().skip();
+        }
+    }
+
+    SBE_NODISCARD static SBE_CONSTEXPR bool isConstLength() SBE_NOEXCEPT {
+        return false;
+    }
+};
+}  // namespace messages
+
+#endif
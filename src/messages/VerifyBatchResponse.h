@@ -0,0 +1,597 @@
+/* Generated SBE (Simple Binary Encoding) message codec */
+#ifndef _MY_APP_MESSAGES_VERIFYBATCHRESPONSE_CXX_H_
+#define _MY_APP_MESSAGES_VERIFYBATCHRESPONSE_CXX_H_
+
+#if __cplusplus >= 201103L
+#define SBE_CONSTEXPR constexpr
+#define SBE_NOEXCEPT noexcept
+#else
+#define SBE_CONSTEXPR
+#define SBE_NOEXCEPT
+#endif
+
+#if __cplusplus >= 201703L
+#include <string_view>
+#define SBE_NODISCARD [[nodiscard]]
+#if !defined(SBE_USE_STRING_VIEW)
+#define SBE_USE_STRING_VIEW 1
+#endif
+#else
+#define SBE_NODISCARD
+#endif
+
+#if __cplusplus >= 202002L
+#include <span>
+#if !defined(SBE_USE_SPAN)
+#define SBE_USE_SPAN 1
+#endif
+#endif
+
+#if !defined(__STDC_LIMIT_MACROS)
+#define __STDC_LIMIT_MACROS 1
+#endif
+
+#include <cstdint>
+#include <cstring>
+#include <iomanip>
+#include <limits>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#if defined(WIN32) || defined(_WIN32)
+#define SBE_BIG_ENDIAN_ENCODE_16(v) _byteswap_ushort(v)
+#define SBE_BIG_ENDIAN_ENCODE_32(v) _byteswap_ulong(v)
+#define SBE_BIG_ENDIAN_ENCODE_64(v) _byteswap_uint64(v)
+#define SBE_LITTLE_ENDIAN_ENCODE_16(v) (v)
+#define SBE_LITTLE_ENDIAN_ENCODE_32(v) (v)
+#define SBE_LITTLE_ENDIAN_ENCODE_64(v) (v)
+#elif __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define SBE_BIG_ENDIAN_ENCODE_16(v) __builtin_bswap16(v)
+#define SBE_BIG_ENDIAN_ENCODE_32(v) __builtin_bswap32(v)
+#define SBE_BIG_ENDIAN_ENCODE_64(v) __builtin_bswap64(v)
+#define SBE_LITTLE_ENDIAN_ENCODE_16(v) (v)
+#define SBE_LITTLE_ENDIAN_ENCODE_32(v) (v)
+#define SBE_LITTLE_ENDIAN_ENCODE_64(v) (v)
+#elif __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#define SBE_LITTLE_ENDIAN_ENCODE_16(v) __builtin_bswap16(v)
+#define SBE_LITTLE_ENDIAN_ENCODE_32(v) __builtin_bswap32(v)
+#define SBE_LITTLE_ENDIAN_ENCODE_64(v) __builtin_bswap64(v)
+#define SBE_BIG_ENDIAN_ENCODE_16(v) (v)
+#define SBE_BIG_ENDIAN_ENCODE_32(v) (v)
+#define SBE_BIG_ENDIAN_ENCODE_64(v) (v)
+#else
+#error \
+    "Byte Ordering of platform not determined. Set __BYTE_ORDER__ manually before including this file."
+#endif
+
+#if !defined(SBE_BOUNDS_CHECK_EXPECT)
+#if defined(SBE_NO_BOUNDS_CHECK)
+#define SBE_BOUNDS_CHECK_EXPECT(exp, c) (false)
+#elif defined(_MSC_VER)
+#define SBE_BOUNDS_CHECK_EXPECT(exp, c) (exp)
+#else
+#define SBE_BOUNDS_CHECK_EXPECT(exp, c) (__builtin_expect(exp, c))
+#endif
+
+#endif
+
+#define SBE_FLOAT_NAN std::numeric_limits<float>::quiet_NaN()
+#define SBE_DOUBLE_NAN std::numeric_limits<double>::quiet_NaN()
+#define SBE_NULLVALUE_INT8 (std::numeric_limits<std::int8_t>::min)()
+#define SBE_NULLVALUE_INT16 (std::numeric_limits<std::int16_t>::min)()
+#define SBE_NULLVALUE_INT32 (std::numeric_limits<std::int32_t>::min)()
+#define SBE_NULLVALUE_INT64 (std::numeric_limits<std::int64_t>::min)()
+#define SBE_NULLVALUE_UINT8 (std::numeric_limits<std::uint8_t>::max)()
+#define SBE_NULLVALUE_UINT16 (std::numeric_limits<std::uint16_t>::max)()
+#define SBE_NULLVALUE_UINT32 (std::numeric_limits<std::uint32_t>::max)()
+#define SBE_NULLVALUE_UINT64 (std::numeric_limits<std::uint64_t>::max)()
+
+#include "BooleanType.h"
+#include "GroupSizeEncoding.h"
+#include "MessageHeader.h"
+
+namespace messages {
+
+class VerifyBatchResponse {
+   private:
+    char *m_buffer = nullptr;
+    std::uint64_t m_bufferLength = 0;
+    std::uint64_t m_offset = 0;
+    std::uint64_t m_position = 0;
+    std::uint64_t m_actingBlockLength = 0;
+    std::uint64_t m_actingVersion = 0;
+
+    inline std::uint64_t *sbePositionPtr() SBE_NOEXCEPT { return &m_position; }
+
+   public:
+    static constexpr std::uint16_t SBE_BLOCK_LENGTH =
+        static_cast<std::uint16_t>(8);
+    static constexpr std::uint16_t SBE_TEMPLATE_ID =
+        static_cast<std::uint16_t>(4);
+    static constexpr std::uint16_t SBE_SCHEMA_ID =
+        static_cast<std::uint16_t>(1);
+    static constexpr std::uint16_t SBE_SCHEMA_VERSION =
+        static_cast<std::uint16_t>(5);
+    static constexpr const char *SBE_SEMANTIC_VERSION = "1.4.0";
+
+    enum MetaAttribute { EPOCH, TIME_UNIT, SEMANTIC_TYPE, PRESENCE };
+
+    union sbe_float_as_uint_u {
+        float fp_value;
+        std::uint32_t uint_value;
+    };
+
+    union sbe_double_as_uint_u {
+        double fp_value;
+        std::uint64_t uint_value;
+    };
+
+    using messageHeader = MessageHeader;
+
+    VerifyBatchResponse() = default;
+
+    VerifyBatchResponse(char *buffer, const std::uint64_t offset,
+                    const std::uint64_t bufferLength,
+                    const std::uint64_t actingBlockLength,
+                    const std::uint64_t actingVersion)
+        : m_buffer(buffer),
+          m_bufferLength(bufferLength),
+          m_offset(offset),
+          m_position(sbeCheckPosition(offset + actingBlockLength)),
+          m_actingBlockLength(actingBlockLength),
+          m_actingVersion(actingVersion) {}
+
+    VerifyBatchResponse(char *buffer, const std::uint64_t bufferLength)
+        : VerifyBatchResponse(buffer, 0, bufferLength, sbeBlockLength(),
+                          sbeSchemaVersion()) {}
+
+    VerifyBatchResponse(char *buffer, const std::uint64_t bufferLength,
+                    const std::uint64_t actingBlockLength,
+                    const std::uint64_t actingVersion)
+        : VerifyBatchResponse(buffer, 0, bufferLength, actingBlockLength,
+                          actingVersion) {}
+
+    SBE_NODISCARD static SBE_CONSTEXPR std::uint16_t sbeBlockLength()
+        SBE_NOEXCEPT {
+        return static_cast<std::uint16_t>(8);
+    }
+
+    SBE_NODISCARD static SBE_CONSTEXPR std::uint64_t sbeBlockAndHeaderLength()
+        SBE_NOEXCEPT {
+        return messageHeader::encodedLength() + sbeBlockLength();
+    }
+
+    SBE_NODISCARD static SBE_CONSTEXPR std::uint16_t sbeTemplateId()
+        SBE_NOEXCEPT {
+        return static_cast<std::uint16_t>(4);
+    }
+
+    SBE_NODISCARD static SBE_CONSTEXPR std::uint16_t sbeSchemaId()
+        SBE_NOEXCEPT {
+        return static_cast<std::uint16_t>(1);
+    }
+
+    SBE_NODISCARD static SBE_CONSTEXPR std::uint16_t sbeSchemaVersion()
+        SBE_NOEXCEPT {
+        return static_cast<std::uint16_t>(5);
+    }
+
+    SBE_NODISCARD static const char *sbeSemanticVersion() SBE_NOEXCEPT {
+        return "1.4.0";
+    }
+
+    SBE_NODISCARD static SBE_CONSTEXPR const char *sbeSemanticType()
+        SBE_NOEXCEPT {
+        return "";
+    }
+
+    SBE_NODISCARD std::uint64_t offset() const SBE_NOEXCEPT { return m_offset; }
+
+    VerifyBatchResponse &wrapForEncode(char *buffer, const std::uint64_t offset,
+                                   const std::uint64_t bufferLength) {
+        m_buffer = buffer;
+        m_bufferLength = bufferLength;
+        m_offset = offset;
+        m_actingBlockLength = sbeBlockLength();
+        m_actingVersion = sbeSchemaVersion();
+        m_position = sbeCheckPosition(m_offset + m_actingBlockLength);
+        return *this;
+    }
+
+    VerifyBatchResponse &wrapAndApplyHeader(char *buffer,
+                                        const std::uint64_t offset,
+                                        const std::uint64_t bufferLength) {
+        messageHeader hdr(buffer, offset, bufferLength, sbeSchemaVersion());
+
+        hdr.blockLength(sbeBlockLength())
+            .templateId(sbeTemplateId())
+            .schemaId(sbeSchemaId())
+            .version(sbeSchemaVersion());
+
+        m_buffer = buffer;
+        m_bufferLength = bufferLength;
+        m_offset = offset + messageHeader::encodedLength();
+        m_actingBlockLength = sbeBlockLength();
+        m_actingVersion = sbeSchemaVersion();
+        m_position = sbeCheckPosition(m_offset + m_actingBlockLength);
+        return *this;
+    }
+
+    VerifyBatchResponse &wrapForDecode(char *buffer, const std::uint64_t offset,
+                                   const std::uint64_t actingBlockLength,
+                                   const std::uint64_t actingVersion,
+                                   const std::uint64_t bufferLength) {
+        m_buffer = buffer;
+        m_bufferLength = bufferLength;
+        m_offset = offset;
+        m_actingBlockLength = actingBlockLength;
+        m_actingVersion = actingVersion;
+        m_position = sbeCheckPosition(m_offset + m_actingBlockLength);
+        return *this;
+    }
+
+    VerifyBatchResponse &sbeRewind() {
+        return wrapForDecode(m_buffer, m_offset, m_actingBlockLength,
+                             m_actingVersion, m_bufferLength);
+    }
+
+    SBE_NODISCARD std::uint64_t sbePosition() const SBE_NOEXCEPT {
+        return m_position;
+    }
+
+    // NOLINTNEXTLINE(readability-convert-member-functions-to-static)
+    std::uint64_t sbeCheckPosition(const std::uint64_t position) {
+        if (SBE_BOUNDS_CHECK_EXPECT((position > m_bufferLength), false)) {
+            throw std::runtime_error("buffer too short [E100]");
+        }
+        return position;
+    }
+
+    void sbePosition(const std::uint64_t position) {
+        m_position = sbeCheckPosition(position);
+    }
+
+    SBE_NODISCARD std::uint64_t encodedLength() const SBE_NOEXCEPT {
+        return sbePosition() - m_offset;
+    }
+
+    SBE_NODISCARD std::uint64_t decodeLength() const {
+        VerifyBatchResponse skipper(m_buffer, m_offset, m_bufferLength,
+                                m_actingBlockLength, m_actingVersion);
+        skipper.skip();
+        return skipper.encodedLength();
+    }
+
+    SBE_NODISCARD const char *buffer() const SBE_NOEXCEPT { return m_buffer; }
+
+    SBE_NODISCARD char *buffer() SBE_NOEXCEPT { return m_buffer; }
+
+    SBE_NODISCARD std::uint64_t bufferLength() const SBE_NOEXCEPT {
+        return m_bufferLength;
+    }
+
+    SBE_NODISCARD std::uint64_t actingVersion() const SBE_NOEXCEPT {
+        return m_actingVersion;
+    }
+
+    SBE_NODISCARD static const char *batchIdMetaAttribute(
+        const MetaAttribute metaAttribute) SBE_NOEXCEPT {
+        switch (metaAttribute) {
+            case MetaAttribute::PRESENCE:
+                return "required";
+            default:
+                return "";
+        }
+    }
+
+    static SBE_CONSTEXPR std::uint16_t batchIdId() SBE_NOEXCEPT { return 1; }
+
+    SBE_NODISCARD static SBE_CONSTEXPR std::uint64_t batchIdSinceVersion()
+        SBE_NOEXCEPT {
+        return 0;
+    }
+
+    SBE_NODISCARD bool batchIdInActingVersion() SBE_NOEXCEPT { return true; }
+
+    SBE_NODISCARD static SBE_CONSTEXPR std::size_t batchIdEncodingOffset()
+        SBE_NOEXCEPT {
+        return 0;
+    }
+
+    SBE_NODISCARD static SBE_CONSTEXPR std::size_t batchIdEncodingLength()
+        SBE_NOEXCEPT {
+        return 8;
+    }
+
+    static SBE_CONSTEXPR std::uint64_t batchIdNullValue() SBE_NOEXCEPT {
+        return SBE_NULLVALUE_UINT64;
+    }
+
+    static SBE_CONSTEXPR std::uint64_t batchIdMinValue() SBE_NOEXCEPT {
+        return UINT64_C(0x0);
+    }
+
+    static SBE_CONSTEXPR std::uint64_t batchIdMaxValue() SBE_NOEXCEPT {
+        return UINT64_C(0xfffffffffffffffe);
+    }
+
+    SBE_NODISCARD std::uint64_t batchId() const SBE_NOEXCEPT {
+        std::uint64_t val;
+        std::memcpy(&val, m_buffer + m_offset + 0, sizeof(std::uint64_t));
+        return SBE_LITTLE_ENDIAN_ENCODE_64(val);
+    }
+
+    VerifyBatchResponse &batchId(const std::uint64_t value) SBE_NOEXCEPT {
+        std::uint64_t val = SBE_LITTLE_ENDIAN_ENCODE_64(value);
+        std::memcpy(m_buffer + m_offset + 0, &val, sizeof(std::uint64_t));
+        return *this;
+    }
+
+    class Results {
+       private:
+        char *m_buffer = nullptr;
+        std::uint64_t m_bufferLength = 0;
+        std::uint64_t m_initialPosition = 0;
+        std::uint64_t *m_positionPtr = nullptr;
+        std::uint64_t m_blockLength = 0;
+        std::uint64_t m_count = 0;
+        std::uint64_t m_index = 0;
+        std::uint64_t m_offset = 0;
+        std::uint64_t m_actingVersion = 0;
+
+        SBE_NODISCARD std::uint64_t *sbePositionPtr() SBE_NOEXCEPT {
+            return m_positionPtr;
+        }
+
+       public:
+        Results() = default;
+
+        inline void wrapForDecode(char *buffer, std::uint64_t *pos,
+                                  const std::uint64_t actingVersion,
+                                  const std::uint64_t bufferLength) {
+            GroupSizeEncoding dimensions(buffer, *pos, bufferLength,
+                                         actingVersion);
+            m_buffer = buffer;
+            m_bufferLength = bufferLength;
+            m_blockLength = dimensions.blockLength();
+            m_count = dimensions.numInGroup();
+            m_index = 0;
+            m_actingVersion = actingVersion;
+            m_initialPosition = *pos;
+            m_positionPtr = pos;
+            *m_positionPtr = *m_positionPtr + 4;
+        }
+
+        inline void wrapForEncode(char *buffer, const std::uint16_t count,
+                                  std::uint64_t *pos,
+                                  const std::uint64_t actingVersion,
+                                  const std::uint64_t bufferLength) {
+#if defined(__GNUG__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wtype-limits"
+#endif
+            if (count > 65534) {
+                throw std::runtime_error(
+                    "count outside of allowed range [E110]");
+            }
+#if defined(__GNUG__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+            m_buffer = buffer;
+            m_bufferLength = bufferLength;
+            GroupSizeEncoding dimensions(buffer, *pos, bufferLength,
+                                         actingVersion);
+            dimensions.blockLength(static_cast<std::uint16_t>(1));
+            dimensions.numInGroup(static_cast<std::uint16_t>(count));
+            m_index = 0;
+            m_count = count;
+            m_blockLength = 1;
+            m_actingVersion = actingVersion;
+            m_initialPosition = *pos;
+            m_positionPtr = pos;
+            *m_positionPtr = *m_positionPtr + 4;
+        }
+
+        static SBE_CONSTEXPR std::uint64_t sbeHeaderSize() SBE_NOEXCEPT {
+            return 4;
+        }
+
+        static SBE_CONSTEXPR std::uint64_t sbeBlockLength() SBE_NOEXCEPT {
+            return 1;
+        }
+
+        SBE_NODISCARD std::uint64_t sbeActingBlockLength() SBE_NOEXCEPT {
+            return m_blockLength;
+        }
+
+        SBE_NODISCARD std::uint64_t sbePosition() const SBE_NOEXCEPT {
+            return *m_positionPtr;
+        }
+
+        // NOLINTNEXTLINE(readability-convert-member-functions-to-static)
+        std::uint64_t sbeCheckPosition(const std::uint64_t position) {
+            if (SBE_BOUNDS_CHECK_EXPECT((position > m_bufferLength), false)) {
+                throw std::runtime_error("buffer too short [E100]");
+            }
+            return position;
+        }
+
+        void sbePosition(const std::uint64_t position) {
+            *m_positionPtr = sbeCheckPosition(position);
+        }
+
+        SBE_NODISCARD inline std::uint64_t count() const SBE_NOEXCEPT {
+            return m_count;
+        }
+
+        SBE_NODISCARD inline bool hasNext() const SBE_NOEXCEPT {
+            return m_index < m_count;
+        }
+
+        inline Results &next() {
+            if (m_index >= m_count) {
+                throw std::runtime_error("index >= count [E108]");
+            }
+            m_offset = *m_positionPtr;
+            if (SBE_BOUNDS_CHECK_EXPECT(
+                    ((m_offset + m_blockLength) > m_bufferLength), false)) {
+                throw std::runtime_error(
+                    "buffer too short for next group index [E108]");
+            }
+            *m_positionPtr = m_offset + m_blockLength;
+            ++m_index;
+
+            return *this;
+        }
+
+        inline std::uint64_t resetCountToIndex() {
+            m_count = m_index;
+            GroupSizeEncoding dimensions(m_buffer, m_initialPosition,
+                                         m_bufferLength, m_actingVersion);
+            dimensions.numInGroup(static_cast<std::uint16_t>(m_count));
+            return m_count;
+        }
+
+        enum MetaAttribute { EPOCH, TIME_UNIT, SEMANTIC_TYPE, PRESENCE };
+
+        SBE_NODISCARD static const char *isVerifiedMetaAttribute(
+            const MetaAttribute metaAttribute) SBE_NOEXCEPT {
+            switch (metaAttribute) {
+                case MetaAttribute::PRESENCE:
+                    return "required";
+                default:
+                    return "";
+            }
+        }
+
+        static SBE_CONSTEXPR std::uint16_t isVerifiedId() SBE_NOEXCEPT { return 3; }
+
+        SBE_NODISCARD static SBE_CONSTEXPR std::uint64_t isVerifiedSinceVersion()
+            SBE_NOEXCEPT {
+            return 0;
+        }
+
+        SBE_NODISCARD bool isVerifiedInActingVersion() SBE_NOEXCEPT { return true; }
+
+        SBE_NODISCARD static SBE_CONSTEXPR std::size_t isVerifiedEncodingOffset()
+            SBE_NOEXCEPT {
+            return 0;
+        }
+
+        SBE_NODISCARD static SBE_CONSTEXPR std::size_t isVerifiedEncodingLength()
+            SBE_NOEXCEPT {
+            return 1;
+        }
+
+        SBE_NODISCARD std::uint8_t isVerifiedRaw() const SBE_NOEXCEPT {
+            std::uint8_t val;
+            std::memcpy(&val, m_buffer + m_offset + 0, sizeof(std::uint8_t));
+            return (val);
+        }
+
+        SBE_NODISCARD BooleanType::Value isVerified() const {
+            std::uint8_t val;
+            std::memcpy(&val, m_buffer + m_offset + 0, sizeof(std::uint8_t));
+            return BooleanType::get((val));
+        }
+
+        Results &isVerified(const BooleanType::Value value) SBE_NOEXCEPT {
+            std::uint8_t val = (value);
+            std::memcpy(m_buffer + m_offset + 0, &val, sizeof(std::uint8_t));
+            return *this;
+        }
+
+    void skip() {}
+
+    SBE_NODISCARD static SBE_CONSTEXPR bool isConstLength() SBE_NOEXCEPT {
+        return true;
+    }
+    };
+
+   private:
+    Results m_results;
+
+   public:
+    SBE_NODISCARD static SBE_CONSTEXPR std::uint16_t resultsId() SBE_NOEXCEPT {
+        return 2;
+    }
+
+    SBE_NODISCARD inline Results &results() {
+        m_results.wrapForDecode(m_buffer, sbePositionPtr(), m_actingVersion,
+                              m_bufferLength);
+        return m_results;
+    }
+
+    Results &resultsCount(const std::uint16_t count) {
+        m_results.wrapForEncode(m_buffer, count, sbePositionPtr(),
+                              m_actingVersion, m_bufferLength);
+        return m_results;
+    }
+
+    SBE_NODISCARD static SBE_CONSTEXPR std::uint64_t resultsSinceVersion()
+        SBE_NOEXCEPT {
+        return 0;
+    }
+
+    SBE_NODISCARD bool resultsInActingVersion() const SBE_NOEXCEPT {
+        return true;
+    }
+
+    template <typename CharT, typename Traits>
+    friend std::basic_ostream<CharT, Traits> &operator<<(
+        std::basic_ostream<CharT, Traits> &builder, const VerifyBatchResponse &_writer) {
+        VerifyBatchResponse writer(_writer.m_buffer, _writer.m_offset,
+                     _writer.m_bufferLength, _writer.m_actingBlockLength,
+                     _writer.m_actingVersion);
+
+        builder << '{';
+        builder << R"("Name": "VerifyBatchResponse", )";
+        builder << R"("sbeTemplateId": )";
+        builder << writer.sbeTemplateId();
+        builder << ", ";
+
+        builder << R"("batchId": )";
+        builder << +writer.batchId();
+
+        builder << ", ";
+        {
+            bool atLeastOne = false;
+            builder << R"("results": [)";
+            auto &group = writer.results();
+            while (group.hasNext()) {
+                if (atLeastOne) {
+                    builder << ", ";
+                }
+                atLeastOne = true;
+                group.next();
+                builder << '{';
+                builder << R"("isVerified": )";
+                builder << '"' << group.isVerified() << '"';
+                builder << '}';
+            }
+            builder << ']';
+        }
+
+        builder << '}';
+
+        return builder;
+    }
+
+    void skip() {
+        auto &resultsGroup{results()};
+        while (resultsGroup.hasNext()) {
+            resultsGroup.next().skip();
+        }
+    }
+
+    SBE_NODISCARD static SBE_CONSTEXPR bool isConstLength() SBE_NOEXCEPT {
+        return false;
+    }
+};
+}  // namespace messages
+
+#endif
@@ -0,0 +1,188 @@
+// Print the engine's shared-memory counters with per-second rates, refreshed
+// every interval. Maps the counters file read-only and never writes to it, so
+// the engine is not slowed down or even aware of it.
+//
+// Usage: ekyc_stat [counters file] [interval ms]
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "CountersLayout.h"
+
+namespace {
+
+constexpr const char *DEFAULT_FILE = "/dev/shm/ekyc-counters";
+constexpr long DEFAULT_INTERVAL_MS = 1000;
+
+class CountersView final {
+   public:
+    ~CountersView() { unmap(); }
+
+    // Map path if it is not mapped yet or was recreated by a new engine
+    bool refresh(const std::string &path) {
+        struct stat st;
+        if (::stat(path.c_str(), &st) != 0) {
+            unmap();
+            return false;
+        }
+        if (_mapping && st.st_ino == _inode) return true;
+
+        unmap();
+        const int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) return false;
+        void *mapping = ::mmap(nullptr, static_cast<std::size_t>(st.st_size),
+                               PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (mapping == MAP_FAILED) return false;
+
+        _mapping = mapping;
+        _length = static_cast<std::size_t>(st.st_size);
+        _inode = st.st_ino;
+        if (valid()) return true;
+
+        // Still being initialised, or not a counters file
+        unmap();
+        return false;
+    }
+
+    const counters::CountersHeader &header() const {
+        return *static_cast<const counters::CountersHeader *>(_mapping);
+    }
+
+    std::uint64_t global(std::size_t id) const { return load(id); }
+
+    std::uint64_t shard(std::size_t shardId, std::size_t id) const {
+        return load(header().globalCounterCount +
+                    shardId * header().shardCounterCount + id);
+    }
+
+   private:
+    bool valid() const {
+        if (_length < sizeof(counters::CountersHeader)) return false;
+        const auto &h = header();
+        return std::memcmp(h.magic, counters::MAGIC, sizeof(h.magic)) == 0 &&
+               h.version == counters::VERSION &&
+               h.globalCounterCount == counters::GLOBAL_COUNTER_COUNT &&
+               h.shardCounterCount == counters::SHARD_COUNTER_COUNT &&
+               _length >= counters::file_length(h.shardCount);
+    }
+
+    std::uint64_t load(std::size_t index) const {
+        const auto *first = reinterpret_cast<const counters::Counter *>(
+            static_cast<const char *>(_mapping) +
+            sizeof(counters::CountersHeader));
+        return first[index].value.load(std::memory_order_relaxed);
+    }
+
+    void unmap() {
+        if (_mapping) ::munmap(_mapping, _length);
+        _mapping = nullptr;
+        _length = 0;
+        _inode = 0;
+    }
+
+    void *_mapping = nullptr;
+    std::size_t _length = 0;
+    ino_t _inode = 0;
+};
+
+// Totals across the engine: global counters, then shard counters summed
+std::vector<std::uint64_t> snapshot(const CountersView &view) {
+    const auto &header = view.header();
+    std::vector<std::uint64_t> values(counters::GLOBAL_COUNTER_COUNT +
+                                      counters::SHARD_COUNTER_COUNT);
+    for (std::size_t id = 0; id < counters::GLOBAL_COUNTER_COUNT; ++id)
+        values[id] = view.global(id);
+    auto *shardTotals = values.data() + counters::GLOBAL_COUNTER_COUNT;
+    for (std::size_t shard = 0; shard < header.shardCount; ++shard)
+        for (std::size_t id = 0; id < counters::SHARD_COUNTER_COUNT; ++id)
+            shardTotals[id] += view.shard(shard, id);
+    return values;
+}
+
+const char *counter_name(std::size_t index) {
+    if (index < counters::GLOBAL_COUNTER_COUNT)
+        return counters::global_counter_name(index);
+    return counters::shard_counter_name(index -
+                                        counters::GLOBAL_COUNTER_COUNT);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    const std::string path = argc > 1 ? argv[1] : DEFAULT_FILE;
+    const long intervalMs =
+        argc > 2 ? std::strtol(argv[2], nullptr, 10) : DEFAULT_INTERVAL_MS;
+    if (intervalMs <= 0) {
+        std::fprintf(stderr, "Usage: %s [counters file] [interval ms]\n",
+                     argv[0]);
+        return 2;
+    }
+
+    CountersView view;
+    std::vector<std::uint64_t> previous;
+    std::uint64_t previousStartNs = 0;
+    auto previousTime = std::chrono::steady_clock::now();
+
+    while (true) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(intervalMs));
+        const auto now = std::chrono::steady_clock::now();
+        const double seconds =
+            std::chrono::duration<double>(now - previousTime).count();
+        previousTime = now;
+
+        // Clear the screen, like AeronStat
+        std::printf("\033[H\033[2J");
+        if (!view.refresh(path)) {
+            std::printf("Waiting for %s ...\n", path.c_str());
+            std::fflush(stdout);
+            previous.clear();
+            continue;
+        }
+
+        const auto &header = view.header();
+        const auto current = snapshot(view);
+        // Rates only make sense against the same engine run
+        if (header.startNs != previousStartNs) previous.clear();
+        previousStartNs = header.startNs;
+
+        std::printf("%s  pid %u  %u shards\n\n", path.c_str(), header.pid,
+                    header.shardCount);
+        std::printf("%-16s %16s %12s\n", "counter", "total", "per sec");
+        for (std::size_t i = 0; i < current.size(); ++i) {
+            // Gauges, shown per shard below
+            if (i == counters::GLOBAL_COUNTER_COUNT + counters::QUEUE_DEPTH ||
+                i == counters::GLOBAL_COUNTER_COUNT + counters::OUTBOUND_DEPTH)
+                continue;
+            const double rate =
+                previous.empty()
+                    ? 0.0
+                    : static_cast<double>(current[i] - previous[i]) / seconds;
+            std::printf("%-16s %16llu %12.0f\n", counter_name(i),
+                        static_cast<unsigned long long>(current[i]), rate);
+        }
+
+        std::printf("\n%-8s %12s %15s\n", "shard", "queue bytes",
+                    "outbound bytes");
+        for (std::size_t shard = 0; shard < header.shardCount; ++shard)
+            std::printf("%-8zu %12llu %15llu\n", shard,
+                        static_cast<unsigned long long>(
+                            view.shard(shard, counters::QUEUE_DEPTH)),
+                        static_cast<unsigned long long>(
+                            view.shard(shard, counters::OUTBOUND_DEPTH)));
+        std::fflush(stdout);
+
+        previous = current;
+    }
+}
@@ -0,0 +1,102 @@
+// Render request journal files written by the engine as text, one line per
+// record.
+//
+// Usage: journal_decode <file.journal>...
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string_view>
+
+#include "IdentityRequest.h"
+#include "JournalRecord.h"
+
+namespace {
+
+// Fixed-width field up to its first NUL
+template <std::size_t N>
+std::string_view text(const char (&field)[N]) {
+    const void *end = std::memchr(field, '\0', N);
+    return {field, end ? static_cast<std::size_t>(
+                             static_cast<const char *>(end) - field)
+                       : N};
+}
+
+void print(const journal::JournalRecord &record) {
+    const auto type = text(record.type);
+    const auto identityNumber = text(record.identityNumber);
+    const auto name = text(record.name);
+    const auto dateOfIssue = text(record.dateOfIssue);
+    const auto dateOfExpiry = text(record.dateOfExpiry);
+    const auto address = text(record.address);
+
+    std::printf(
+        "%llu recv=%llu latency_ns=%llu corr=%llu template=%u kind=%s "
+        "outcome=%s source=%s type=%.*s id=%.*s name=%.*s issued=%.*s "
+        "expires=%.*s address=%.*s\n",
+        static_cast<unsigned long long>(record.sequence),
+        static_cast<unsigned long long>(record.receiveTimeNs),
+        static_cast<unsigned long long>(
+            record.completeTimeNs >= record.receiveTimeNs
+                ? record.completeTimeNs - record.receiveTimeNs
+                : 0),
+        static_cast<unsigned long long>(record.correlationId),
+        static_cast<unsigned>(record.templateId),
+        kind_name(static_cast<messages::MessageKind::Value>(record.kind)),
+        journal::outcome_name(record.outcome),
+        journal::source_name(record.source), static_cast<int>(type.size()),
+        type.data(), static_cast<int>(identityNumber.size()),
+        identityNumber.data(), static_cast<int>(name.size()), name.data(),
+        static_cast<int>(dateOfIssue.size()), dateOfIssue.data(),
+        static_cast<int>(dateOfExpiry.size()), dateOfExpiry.data(),
+        static_cast<int>(address.size()), address.data());
+}
+
+bool decode(const char *path) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        std::fprintf(stderr, "%s: cannot open\n", path);
+        return false;
+    }
+
+    journal::JournalHeader header;
+    if (!in.read(reinterpret_cast<char *>(&header), sizeof(header)) ||
+        std::memcmp(header.magic, journal::MAGIC, sizeof(header.magic)) !=
+            0) {
+        std::fprintf(stderr, "%s: not a request journal\n", path);
+        return false;
+    }
+    if (header.version != journal::VERSION ||
+        header.recordSize != sizeof(journal::JournalRecord)) {
+        std::fprintf(stderr,
+                     "%s: unsupported journal version %u, record size %u\n",
+                     path, header.version, header.recordSize);
+        return false;
+    }
+
+    std::printf("# %s shard=%u created=%llu\n", path, header.shardId,
+                static_cast<unsigned long long>(header.createdNs));
+
+    journal::JournalRecord record;
+    while (in.read(reinterpret_cast<char *>(&record), sizeof(record))) {
+        // Preallocated space the engine never reached
+        if (record.sequence == 0) break;
+        print(record);
+    }
+    return true;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        std::fprintf(stderr, "Usage: %s <file.journal>...\n", argv[0]);
+        return 2;
+    }
+
+    int status = 0;
+    for (int i = 1; i < argc; ++i)
+        if (!decode(argv[i])) status = 1;
+    return status;
+}